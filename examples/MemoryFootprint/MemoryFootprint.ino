@@ -0,0 +1,67 @@
+/**
+ * Prints the size (and alignment) of the library classes on this board, to help when
+ * deciding how many widgets and keypads will fit in RAM.
+ * 
+ * The 'own' column is the size added by a class over its base class (including any padding).
+ */
+#include <Arduino.h>
+
+#include "ui/Region.h"
+#include "ui/BaseWidget.h"
+#include "ui/BaseIcon.h"
+#include "ui/WidgetContainer.h"
+#include "TouchKeypad/TouchKeypadKey.h"
+#include "TouchKeypad/BaseTouchKeypadWidget.h"
+#include "TouchKeypad/CompactTouchKeypadWidget.h"
+
+using namespace input_events;
+
+// Minimal concrete classes so the abstract classes can be measured
+class Keypad : public BaseTouchKeypadWidget<6, 10> {
+    public:
+    Keypad() : BaseTouchKeypadWidget(0, 0, 320, 240) {}
+    void clear() override {}
+    void drawKey(TouchKeypadKey&) override {}
+    bool onTouchKeyEvent(TouchKeypadKey&, InputEventType, EventTouchScreen&) override { return true; }
+};
+
+class CompactKeypad : public CompactTouchKeypadWidget<6, 10> {
+    public:
+    CompactKeypad() : CompactTouchKeypadWidget(0, 0, 320, 240) {}
+    void clear() override {}
+    void drawKey(const KeypadKeyRef&) override {}
+    bool onTouchKeyEvent(const KeypadKeyRef&, InputEventType, EventTouchScreen&) override { return true; }
+};
+
+void printRow(const char* name, size_t size, size_t align, size_t base = 0) {
+    Serial.print(name);
+    for ( size_t i = strlen(name); i < 32; i++ ) Serial.print(' ');
+    Serial.print(size);
+    Serial.print("\t");
+    Serial.print(align);
+    Serial.print("\t");
+    if ( base > 0 ) Serial.print(size - base);
+    Serial.println();
+}
+
+#define PRINT_SIZE(T) printRow(#T, sizeof(T), alignof(T))
+#define PRINT_SIZE_BASE(T, B) printRow(#T, sizeof(T), alignof(T), sizeof(B))
+
+void setup() {
+    Serial.begin(9600);
+    delay(1000);
+
+    Serial.println("Class                           size\talign\town");
+    PRINT_SIZE(Coords_s);
+    PRINT_SIZE(Region);
+    PRINT_SIZE_BASE(BaseWidget, Region);
+    PRINT_SIZE_BASE(TouchKeypadKey, BaseWidget);
+    PRINT_SIZE(IconParams);
+    PRINT_SIZE(KeypadKeyRef);
+    PRINT_SIZE_BASE(WidgetContainer<10>, BaseWidget);
+    PRINT_SIZE_BASE(Keypad, BaseWidget);
+    PRINT_SIZE_BASE(CompactKeypad, BaseWidget);
+}
+
+void loop() {
+}
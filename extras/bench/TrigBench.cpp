@@ -0,0 +1,67 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+/**
+ * Host benchmark of the Q15 fixed-point trig in FixedTrig.h against libm, as used to place icon vertices.
+ * See extras/README.md to build. Desktop FPUs make libm much cheaper than it is on an MCU without a double 
+ * precision FPU, so treat the ratio as a lower bound.
+ */
+
+#include <Arduino.h>
+#include <stdio.h>
+#include "ui/FixedTrig.h"
+
+using namespace input_events;
+
+static const int16_t Radius = 100;
+static const uint32_t Rounds = 20000;
+
+static volatile int32_t sink = 0; //Stop the loops being optimised away
+
+static uint32_t benchFixed() {
+    uint32_t start = micros();
+    for (uint32_t r = 0; r < Rounds; ++r) {
+        for (int16_t d = 0; d < 360; ++d) {
+            Coords_s p = pointOnArc(Coords_s(160, 120), Radius, d);
+            sink = sink + p.x + p.y;
+        }
+    }
+    return micros() - start;
+}
+
+static uint32_t benchLibm() {
+    uint32_t start = micros();
+    for (uint32_t r = 0; r < Rounds; ++r) {
+        for (int16_t d = 0; d < 360; ++d) {
+            double a = d * DEG_TO_RAD;
+            int32_t x = 160 + static_cast<int32_t>(lround(Radius * cos(a)));
+            int32_t y = 120 + static_cast<int32_t>(lround(Radius * sin(a)));
+            sink = sink + x + y;
+        }
+    }
+    return micros() - start;
+}
+
+int main() {
+    int maxError = 0;
+    for (int16_t d = -720; d <= 720; ++d) {
+        Coords_s p = pointOnArc(Coords_s(160, 120), Radius, d);
+        double a = d * DEG_TO_RAD;
+        int ex = abs(p.x - (160 + static_cast<int>(lround(Radius * cos(a)))));
+        int ey = abs(p.y - (120 + static_cast<int>(lround(Radius * sin(a)))));
+        maxError = max(maxError, max(ex, ey));
+    }
+    uint32_t fixedUs = benchFixed();
+    uint32_t libmUs = benchLibm();
+    double points = static_cast<double>(Rounds) * 360;
+    printf("pointOnArc (Q15): %8.2f ns/point\n", fixedUs * 1000.0 / points);
+    printf("cos/sin (libm):   %8.2f ns/point\n", libmUs * 1000.0 / points);
+    printf("speed up: %.2fx, max error at radius %d: %d px\n", 
+        fixedUs ? static_cast<double>(libmUs) / fixedUs : 0.0, Radius, maxError);
+    return maxError <= 1 ? 0 : 1;
+}
@@ -0,0 +1,43 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+/**
+ * @brief Just enough of Arduino.h to compile the library's headers on a desktop for the host tests and 
+ * benchmarks in extras/. Not used by any board build.
+ * 
+ */
+#ifndef INPUT_EVENTS_HOST_ARDUINO_H
+#define INPUT_EVENTS_HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+
+using std::min;
+using std::max;
+
+inline uint32_t micros() {
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+inline uint32_t millis() { return micros() / 1000; }
+
+inline void yield() { std::this_thread::yield(); }
+
+#endif
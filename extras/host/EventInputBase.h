@@ -0,0 +1,42 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+/**
+ * @brief Just enough of EventInputBase from the InputEvents library for EventTouchScreen to compile in the host 
+ * programs in extras/ (callbacks are never invoked, so there are no timers or idle events). Not used by any 
+ * board build.
+ * 
+ */
+#ifndef INPUT_EVENTS_HOST_EVENT_INPUT_BASE_H
+#define INPUT_EVENTS_HOST_EVENT_INPUT_BASE_H
+
+#include <Arduino.h>
+#include "InputEvents.h"
+
+class EventInputBase {
+
+    public:
+
+    virtual ~EventInputBase() {}
+    virtual void unsetCallback() { callbackIsSet = false; }
+    void update() {}
+    bool isEnabled() { return _enabled; }
+
+    protected:
+
+    virtual void invoke(InputEventType et) = 0;
+    virtual void onDisabled() {}
+    bool isInvokable(InputEventType /*et*/) { return callbackIsSet; }
+    void resetIdleTimer() {}
+
+    bool _enabled = true;
+    bool callbackIsSet = false;
+
+};
+
+#endif
@@ -0,0 +1,35 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+/**
+ * @brief The InputEventType enum from the InputEvents library, for host tests that only need the event types. 
+ * Not used by any board build.
+ * 
+ */
+#ifndef INPUT_EVENTS_HOST_INPUT_EVENTS_H
+#define INPUT_EVENTS_HOST_INPUT_EVENTS_H
+
+#include <Arduino.h>
+
+enum class InputEventType : uint8_t {
+    NONE,
+    ENABLED,
+    DISABLED,
+    IDLE,
+    PRESSED,
+    RELEASED,
+    CLICKED,
+    DOUBLE_CLICKED,
+    MULTI_CLICKED,
+    LONG_CLICKED,
+    LONG_PRESS,
+    DRAGGED,
+    DRAGGED_RELEASED
+};
+
+#endif
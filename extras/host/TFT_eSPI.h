@@ -0,0 +1,19 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+/**
+ * @brief An empty TFT_eSPI.h, so headers that include it (eg ui/BaseIcon.h) compile in the host programs in 
+ * extras/. The library headers do not use TFT_eSPI itself. Not used by any board build.
+ * 
+ */
+#ifndef INPUT_EVENTS_HOST_TFT_ESPI_H
+#define INPUT_EVENTS_HOST_TFT_ESPI_H
+
+#include <Arduino.h>
+
+#endif
@@ -0,0 +1,68 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+/**
+ * Host version of examples/MemoryFootprint: prints the size (and alignment) of the library classes on the 
+ * host, so a change to a class's size can be checked without a board. Sizes on a 32 bit MCU are usually 
+ * smaller, as pointers are 4 bytes. See extras/README.md to build.
+ * 
+ * The 'own' column is the size added by a class over its base class (including any padding).
+ */
+
+#include <Arduino.h>
+#include <stdio.h>
+
+#include "ui/Region.h"
+#include "ui/BaseWidget.h"
+#include "ui/BaseIcon.h"
+#include "ui/WidgetContainer.h"
+#include "TouchKeypad/TouchKeypadKey.h"
+#include "TouchKeypad/BaseTouchKeypadWidget.h"
+#include "TouchKeypad/CompactTouchKeypadWidget.h"
+
+using namespace input_events;
+
+// Minimal concrete classes so the abstract classes can be measured
+class Keypad : public BaseTouchKeypadWidget<6, 10> {
+    public:
+    Keypad() : BaseTouchKeypadWidget(0, 0, 320, 240) {}
+    void clear() override {}
+    void drawKey(TouchKeypadKey&) override {}
+    bool onTouchKeyEvent(TouchKeypadKey&, InputEventType, EventTouchScreen&) override { return true; }
+};
+
+class CompactKeypad : public CompactTouchKeypadWidget<6, 10> {
+    public:
+    CompactKeypad() : CompactTouchKeypadWidget(0, 0, 320, 240) {}
+    void clear() override {}
+    void drawKey(const KeypadKeyRef&) override {}
+    bool onTouchKeyEvent(const KeypadKeyRef&, InputEventType, EventTouchScreen&) override { return true; }
+};
+
+void printRow(const char* name, size_t size, size_t align, size_t base = 0) {
+    printf("%-32s%zu\t%zu\t", name, size, align);
+    if ( base > 0 ) printf("%zu", size - base);
+    printf("\n");
+}
+
+#define PRINT_SIZE(T) printRow(#T, sizeof(T), alignof(T))
+#define PRINT_SIZE_BASE(T, B) printRow(#T, sizeof(T), alignof(T), sizeof(B))
+
+int main() {
+    printf("Class                           size\talign\town\n");
+    PRINT_SIZE(Coords_s);
+    PRINT_SIZE(Region);
+    PRINT_SIZE_BASE(BaseWidget, Region);
+    PRINT_SIZE_BASE(TouchKeypadKey, BaseWidget);
+    PRINT_SIZE(IconParams);
+    PRINT_SIZE(KeypadKeyRef);
+    PRINT_SIZE_BASE(WidgetContainer<10>, BaseWidget);
+    PRINT_SIZE_BASE(Keypad, BaseWidget);
+    PRINT_SIZE_BASE(CompactKeypad, BaseWidget);
+    return 0;
+}
@@ -0,0 +1,128 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+/**
+ * Host stress test of AtomicTouchEventQueue, to be built with ThreadSanitizer. A producer thread pushes touches 
+ * (PRESSED, DRAGGED..., RELEASED) while the consumer pops with long pauses, as if drawing. Every touch that 
+ * starts must end, in order, and DRAGGED events must never go backwards. See extras/README.md to build.
+ */
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <thread>
+#include <atomic>
+#include "AtomicTouchEventQueue.h"
+
+using namespace input_events;
+
+static int failures = 0;
+
+static void expect(bool ok, const char* what) {
+    printf("%s: %s\n", ok ? "ok" : "FAIL", what);
+    if ( !ok ) failures++;
+}
+
+static TouchEvent_s makeEvent(InputEventType type, uint16_t touch, uint16_t step) {
+    TouchEvent_s event;
+    event.type = type;
+    event.touchPoint = TouchPoint_s(touch, step, 1);
+    return event;
+}
+
+//A drag that fills the queue while the consumer is drawing still ends with its RELEASED
+static void testLongDraw() {
+    AtomicTouchEventQueue<4> queue;
+    queue.push(makeEvent(InputEventType::PRESSED, 1, 0));
+    for (uint16_t step = 1; step <= 100; step++) queue.push(makeEvent(InputEventType::DRAGGED, 1, step));
+    queue.push(makeEvent(InputEventType::RELEASED, 1, 101));
+    TouchEvent_s event;
+    InputEventType types[8];
+    uint8_t count = 0;
+    while ( count < 8 && queue.pop(event) ) types[count++] = event.type;
+    expect(count >= 2 && types[0] == InputEventType::PRESSED && types[count - 1] == InputEventType::RELEASED, 
+        "long draw: touch starts and ends");
+}
+
+//A held DRAGGED is published with the latest position once the consumer makes room
+static void testFlush() {
+    AtomicTouchEventQueue<2> queue;
+    queue.push(makeEvent(InputEventType::PRESSED, 1, 0));
+    queue.push(makeEvent(InputEventType::DRAGGED, 1, 1)); //Only the reserved slot is free, held
+    queue.push(makeEvent(InputEventType::DRAGGED, 1, 2)); //Merged into the held DRAGGED
+    TouchEvent_s event;
+    queue.pop(event);
+    queue.flush();
+    bool popped = queue.pop(event);
+    expect(popped && event.type == InputEventType::DRAGGED && event.touchPoint.y == 2, "flush: latest drag published");
+}
+
+//Producer and consumer on separate threads, consumer pausing as if drawing
+static void testThreads() {
+    const uint16_t Touches = 20000;
+    AtomicTouchEventQueue<8> queue;
+    std::atomic<bool> done{false};
+    std::thread producer([&queue, &done, Touches] {
+        for (uint16_t touch = 1; touch <= Touches; touch++) {
+            queue.push(makeEvent(InputEventType::PRESSED, touch, 0));
+            uint16_t steps = touch % 40;
+            for (uint16_t step = 1; step <= steps; step++) {
+                queue.push(makeEvent(InputEventType::DRAGGED, touch, step));
+                if ( step % 8 == 0 ) std::this_thread::yield();
+            }
+            queue.push(makeEvent(touch % 2 ? InputEventType::RELEASED : InputEventType::DRAGGED_RELEASED, touch, 0));
+            std::this_thread::yield();
+        }
+        done.store(true);
+    });
+    uint16_t current = 0; //The touch in progress, 0 if none
+    uint16_t lastStep = 0;
+    uint16_t lastTouch = 0; //The last touch that ended
+    uint32_t started = 0, ended = 0, outOfOrder = 0, popped = 0;
+    TouchEvent_s event;
+    while ( true ) {
+        bool finished = done.load(); //Everything pushed before this is popped before the queue is empty
+        if ( !queue.pop(event) ) {
+            if ( finished ) break;
+            std::this_thread::yield();
+            continue;
+        }
+        popped++;
+        if ( popped % 64 == 0 ) std::this_thread::sleep_for(std::chrono::microseconds(200)); //Drawing
+        uint16_t touch = event.touchPoint.x;
+        switch ( event.type ) {
+            case InputEventType::PRESSED :
+                if ( current != 0 || touch <= lastTouch ) outOfOrder++;
+                current = touch;
+                lastStep = 0;
+                started++;
+                break;
+            case InputEventType::DRAGGED :
+                if ( touch != current || event.touchPoint.y <= lastStep ) outOfOrder++;
+                lastStep = event.touchPoint.y;
+                break;
+            default : //RELEASED or DRAGGED_RELEASED
+                if ( touch != current ) outOfOrder++;
+                current = 0;
+                lastTouch = touch;
+                ended++;
+                break;
+        }
+    }
+    producer.join();
+    printf("threads: %u events popped, %u touches started, %u ended, %u dropped\n", 
+        popped, started, ended, queue.dropped());
+    expect(outOfOrder == 0, "threads: events in order");
+    expect(started == ended && current == 0, "threads: every touch that starts ends");
+}
+
+int main() {
+    testLongDraw();
+    testFlush();
+    testThreads();
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,123 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+/**
+ * Host test of BandTransitionRenderer: each style puts the screens' pixels in the right place half way through,
+ * and getCurrent() is nullptr until the next screen is started. See extras/README.md to build.
+ */
+
+#include <Arduino.h>
+#include <stdio.h>
+#include "ScreenManager/BandTransitionRenderer.h"
+#include "ScreenManager/BaseScreen.h"
+
+using namespace input_events;
+
+static const uint16_t Width = 40;
+static const uint16_t Height = 30;
+static uint16_t display[Width * Height];
+
+void writeBlock(const Region& region, const uint16_t* pixels) {
+    for (uint16_t y = 0; y < region.h(); y++) {
+        for (uint16_t x = 0; x < region.w(); x++) {
+            display[(region.y() + y) * Width + region.x() + x] = pixels[y * region.w() + x];
+        }
+    }
+}
+
+//Fills the whole screen with one colour
+class ColourScreen : public BaseScreen {
+    public:
+    ColourScreen(const char* name, uint16_t colour) : screenName(name), colour(colour) {}
+    std::string name() const override { return screenName; }
+    void begin() override {}
+    void start() override { starts++; }
+    void draw() override {}
+    void end() override {}
+    bool drawTransitionBand(BandCanvas& canvas) override {
+        canvas.fillRect(0, 0, Width, Height, colour);
+        return true;
+    }
+    int starts = 0;
+    private:
+    std::string screenName;
+    uint16_t colour;
+};
+
+static int failures = 0;
+
+void expect(const char* test, uint16_t x, uint16_t y, uint16_t colour) {
+    if ( display[y * Width + x] == colour ) return;
+    printf("FAIL %s: pixel %u,%u is %04x, expected %04x\n", test, x, y, display[y * Width + x], colour);
+    failures++;
+}
+
+int main() {
+    const uint16_t Red = 0xF800;
+    const uint16_t Blue = 0x001F;
+    EventScreenManager manager;
+    ColourScreen from("from", Red);
+    ColourScreen to("to", Blue);
+    manager.registerScreen(&from);
+    manager.registerScreen(&to);
+    BandTransitionRenderer<Width * 7> renderer(manager, Region(0, 0, Width, Height), writeBlock);
+
+    TransitionFrame frame;
+    frame.from = manager.getHandle(&from);
+    frame.to = manager.getHandle(&to);
+    frame.progress = TransitionFrame::PROGRESS_MAX / 2;
+
+    frame.style = TransitionStyle::SlideLeft;
+    renderer.drawTransitionFrame(frame);
+    expect("SlideLeft", 19, 0, Red);
+    expect("SlideLeft", 20, Height - 1, Blue);
+
+    frame.style = TransitionStyle::SlideDown;
+    renderer.drawTransitionFrame(frame);
+    expect("SlideDown", 0, 14, Blue);
+    expect("SlideDown", Width - 1, 15, Red);
+
+    frame.style = TransitionStyle::WipeLeft;
+    renderer.drawTransitionFrame(frame);
+    expect("WipeLeft", 19, 10, Red);
+    expect("WipeLeft", 20, 10, Blue);
+
+    frame.style = TransitionStyle::WipeRight;
+    renderer.drawTransitionFrame(frame);
+    expect("WipeRight", 19, 10, Blue);
+    expect("WipeRight", 20, 10, Red);
+
+    frame.style = TransitionStyle::Fade;
+    frame.progress = TransitionFrame::PROGRESS_MAX / 4;
+    renderer.drawTransitionFrame(frame);
+    expect("Fade out", 0, 0, BandTransitionRenderer<1>::blend(Red, 0, 128));
+    frame.progress = TransitionFrame::PROGRESS_MAX;
+    renderer.drawTransitionFrame(frame);
+    expect("Fade in", 0, 0, Blue);
+
+    //No touch reaches the next screen before its start()
+    manager.setTransition(&renderer, TransitionStyle::SlideLeft, 20);
+    manager.begin();
+    manager.update();
+    manager.requestScreen(frame.to);
+    manager.update();
+    if ( manager.getCurrent() != nullptr || to.starts != 0 ) {
+        printf("FAIL getCurrent() during the transition\n");
+        failures++;
+    }
+    uint32_t start = millis();
+    while ( manager.isTransitioning() && millis() - start < 1000 ) manager.update();
+    if ( manager.getCurrent() != &to || to.starts != 1 ) {
+        printf("FAIL getCurrent() after the transition\n");
+        failures++;
+    }
+    expect("Complete", 0, 0, Blue);
+
+    if ( failures == 0 ) printf("ok: every style draws both screens, touch waits for start()\n");
+    return failures == 0 ? 0 : 1;
+}
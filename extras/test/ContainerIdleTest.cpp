@@ -0,0 +1,84 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+/**
+ * Host test that a screen drawing a WidgetContainer is idle once everything has been drawn, and needs a frame 
+ * again when a widget changes. See extras/README.md to build.
+ */
+
+#include <Arduino.h>
+#include <stdio.h>
+#include "ui/WidgetContainer.h"
+#include "ScreenManager/EventScreenManager.h"
+#include "ScreenManager/BaseScreen.h"
+
+using namespace input_events;
+
+class CountingWidget : public BaseWidget {
+    public:
+    CountingWidget(uint16_t x, uint16_t y, uint16_t w, uint16_t h) : BaseWidget(x, y, w, h) {}
+    void start() override { redrawRequired(); }
+    void draw() override {
+        if ( !isRedrawRequired() ) return;
+        draws++;
+        redrawRequired(false);
+    }
+    void clear() override {}
+    void end() override {}
+    void onStateChanged() override { redrawRequired(); }
+    int draws = 0;
+};
+
+class ContainerScreen : public BaseScreen {
+    public:
+    ContainerScreen() {
+        container.addWidget(&left);
+        container.addWidget(&right);
+    }
+    std::string name() const override { return "container"; }
+    void begin() override { container.begin(); }
+    void start() override { container.start(); }
+    bool needsDraw() override { return container.isRedrawPending(); }
+    void draw() override { container.draw(); }
+    void end() override { container.end(); }
+    WidgetContainer<2> container = WidgetContainer<2>(0, 0, 100, 50);
+    CountingWidget left = CountingWidget(0, 0, 50, 50);
+    CountingWidget right = CountingWidget(50, 0, 50, 50);
+};
+
+static int failures = 0;
+
+static void expect(bool ok, const char* what) {
+    printf("%s: %s\n", ok ? "ok" : "FAIL", what);
+    if ( !ok ) failures++;
+}
+
+static void waitForFrame(EventScreenManager& manager) {
+    while ( manager.msToNextFrame() > 0 ) yield();
+    manager.update();
+}
+
+int main() {
+    EventScreenManager manager;
+    manager.setKeepAlive(0);
+    ContainerScreen screen;
+    manager.registerScreen(&screen);
+    manager.begin();
+    manager.update(); //Starts the screen and draws the first frame
+    expect(screen.left.draws == 1 && screen.right.draws == 1, "first frame draws each widget once");
+    expect(!screen.container.isRedrawPending(), "container has nothing pending after one draw");
+    expect(manager.isIdle(), "screen is idle after one draw");
+
+    screen.right.redrawRequired();
+    expect(!manager.isIdle(), "needs a frame when a widget changes");
+    waitForFrame(manager);
+    expect(screen.left.draws == 1 && screen.right.draws == 2, "only the changed widget is drawn");
+    expect(manager.isIdle(), "screen is idle again");
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,66 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+/**
+ * Host test that the disabled grey lookup tables are bit-exact with disabledGreyReference() for all 65536 
+ * RGB565 colours, with disabledGreyLut() and with disabledGreySpan() (into a second buffer and in place). 
+ * See extras/README.md to build.
+ */
+
+#include <Arduino.h>
+#include <stdio.h>
+#include "ui/DisabledGrey.h"
+
+using namespace input_events;
+
+static const size_t Colours = 65536;
+static uint16_t src[Colours];
+static uint16_t dst[Colours];
+static uint16_t expected[Colours];
+
+static int failures = 0;
+
+void check(const char* test, const uint16_t* result) {
+    int mismatches = 0;
+    for (size_t c = 0; c < Colours; c++) {
+        if ( result[c] == expected[c] ) continue;
+        if ( mismatches++ == 0 ) {
+            printf("FAIL %s: %04zx gives %04x, expected %04x\n", test, c, result[c], expected[c]);
+        }
+    }
+    if ( mismatches > 0 ) {
+        printf("FAIL %s: %d of %zu colours differ\n", test, mismatches, Colours);
+        failures++;
+    }
+}
+
+int main() {
+    for (size_t c = 0; c < Colours; c++) {
+        src[c] = static_cast<uint16_t>(c);
+        expected[c] = disabledGreyReference(static_cast<uint16_t>(c));
+        dst[c] = disabledGreyLut(static_cast<uint16_t>(c));
+    }
+    check("disabledGreyLut", dst);
+
+    disabledGreySpan(src, dst, Colours);
+    check("disabledGreySpan", dst);
+
+    disabledGreySpan(src, src, Colours);
+    check("disabledGreySpan in place", src);
+
+    //Runs of the same colour, as in a bitmap icon
+    for (size_t c = 0; c < Colours; c++) {
+        src[c] = static_cast<uint16_t>(c & ~static_cast<size_t>(7));
+        expected[c] = disabledGreyReference(src[c]);
+    }
+    disabledGreySpan(src, src, Colours);
+    check("disabledGreySpan runs in place", src);
+
+    if ( failures == 0 ) printf("ok: all %zu colours match disabledGreyReference()\n", Colours);
+    return failures == 0 ? 0 : 1;
+}
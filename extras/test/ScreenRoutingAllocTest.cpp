@@ -0,0 +1,92 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+/**
+ * Host test that screen transitions by handle and Back through a router never allocate. Global operator new 
+ * asserts while allocations are forbidden. See extras/README.md to build.
+ */
+
+#include <Arduino.h>
+#include <assert.h>
+#include <stdio.h>
+#include <new>
+#include "ScreenManager/EventScreenManager.h"
+#include "ScreenManager/BaseScreen.h"
+
+static bool allocationsForbidden = false;
+
+void* operator new(size_t size) {
+    assert(!allocationsForbidden && "allocation during a screen transition");
+    void* p = malloc(size ? size : 1);
+    if ( !p ) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+using namespace input_events;
+
+//Names longer than the small string buffer, so copying one would allocate
+class NamedScreen : public BaseScreen {
+    public:
+    explicit NamedScreen(const char* name) : screenName(name) {}
+    std::string name() const override { return screenName; }
+    void begin() override {}
+    void start() override { starts++; }
+    void draw() override {}
+    void end() override {}
+    int starts = 0;
+    private:
+    std::string screenName;
+};
+
+class BackToHomeRouter : public IScreenRouter {
+    public:
+    ScreenHandle resolveScreen(ScreenHandle /*current*/, const TransitionIntent& intent) override {
+        return intent.type == TransitionIntentType::Back ? home : InvalidScreenHandle;
+    }
+    ScreenHandle home = InvalidScreenHandle;
+};
+
+int main() {
+    EventScreenManager manager;
+    NamedScreen home("home-screen-with-a-long-name");
+    NamedScreen menu("menu-screen-with-a-long-name");
+    NamedScreen settings("settings-screen-with-a-long-name");
+    manager.registerScreen(&home);
+    manager.registerScreen(&menu);
+    manager.registerScreen(&settings);
+    BackToHomeRouter router;
+    router.home = manager.getHandle("home-screen-with-a-long-name");
+    manager.addRouter(&router);
+    ScreenHandle menuHandle = manager.getHandle(&menu);
+    ScreenHandle settingsHandle = manager.getHandle(&settings);
+    manager.begin();
+    manager.update();
+
+    const int Transitions = 10000;
+    int correct = 0;
+    allocationsForbidden = true;
+    for (int i = 0; i < Transitions; i++) {
+        ScreenHandle expected;
+        if ( i % 3 == 2 ) {
+            manager.requestScreen(TransitionIntent{TransitionIntentType::Back});
+            expected = router.home;
+        } else {
+            expected = (i % 3 == 0) ? menuHandle : settingsHandle;
+            manager.requestScreen(expected);
+        }
+        manager.update();
+        if ( manager.isCurrent(expected) ) correct++;
+    }
+    allocationsForbidden = false;
+
+    printf("%d of %d transitions correct, no allocations\n", correct, Transitions);
+    return correct == Transitions ? 0 : 1;
+}
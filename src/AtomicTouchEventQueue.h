@@ -0,0 +1,210 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+#ifndef INPUT_EVENTS_ATOMIC_TOUCH_EVENT_QUEUE_H
+#define INPUT_EVENTS_ATOMIC_TOUCH_EVENT_QUEUE_H
+
+#if defined(__has_include)
+#if __has_include(<atomic>) //Check if std::atomic is supported
+
+#include <Arduino.h>
+#include <atomic>
+#include "TouchEvent_s.h"
+
+namespace input_events {
+
+/**
+ * @brief A lock-free, bounded, single producer single consumer (SPSC) queue of TouchEvent_s. Used by EventTouchScreen
+ * in place of TouchEventQueue when `TOUCH_SCREEN_THREADED` is defined.
+ * 
+ * @details push() must only be called from one thread (the touch sampling task) and pop(), clear() and size() from 
+ * one other thread (the thread that calls `EventTouchScreen::processEventQueue()`). Neither side ever waits.
+ * 
+ * Consecutive DRAGGED events are coalesced by the consumer: pop() merges any DRAGGED events that immediately follow 
+ * a DRAGGED event into it, keeping the start and previous touch points of the first, the same as TouchEventQueue.
+ * 
+ * The producer cannot remove published events, so it never fills the queue with DRAGGED events. The last free slot 
+ * is reserved for RELEASED and DRAGGED_RELEASED, so a touch always ends. A DRAGGED event that does not fit is held 
+ * by the producer (merged with any later DRAGGED events) and published by the next push() or `flush()` once there 
+ * is room. If a RELEASED or DRAGGED_RELEASED arrives first, the held DRAGGED is dropped. Any other event that does 
+ * not fit is dropped, and if it is a PRESSED, the rest of that touch is dropped too. `dropped()` counts them all.
+ * 
+ * @tparam Capacity Maximum number of queued events (max 254)
+ */
+template<uint8_t Capacity>
+class AtomicTouchEventQueue {
+
+    public:
+
+    /**
+     * @brief Add an event to the back of the queue. Producer only.
+     * 
+     * @param event 
+     * @return true The event was queued, or is a DRAGGED held until there is room
+     * @return false The event was dropped
+     */
+    bool push(const TouchEvent_s& event) {
+        discardIfCleared();
+        if ( skipTouch ) { //The PRESSED of this touch was dropped
+            if ( endsTouch(event.type) ) skipTouch = false;
+            countDropped();
+            return false;
+        }
+        if ( event.type == InputEventType::DRAGGED ) {
+            if ( hasPending ) {
+                pending.touchPoint = event.touchPoint;
+                pending.clickCount = event.clickCount;
+                pending.longPressCount = event.longPressCount;
+            } else {
+                pending = event;
+                hasPending = true;
+            }
+            flush();
+            return true;
+        }
+        bool ends = endsTouch(event.type);
+        if ( !flush() && ends ) { //Only the reserved slot is free, the end of the touch supersedes the drag
+            hasPending = false;
+            countDropped();
+        }
+        if ( !publish(event, ends ? 0 : Reserved) ) {
+            if ( event.type == InputEventType::PRESSED ) skipTouch = true;
+            countDropped();
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Publish a held DRAGGED event if there is now room. Call from the producer when there is no event to 
+     * push (EventTouchScreen::update() calls it on every update). Producer only.
+     * 
+     * @return true Nothing is held
+     * @return false A DRAGGED is still held
+     */
+    bool flush() {
+        discardIfCleared();
+        if ( !hasPending ) return true;
+        if ( !publish(pending, Reserved) ) return false;
+        hasPending = false;
+        return true;
+    }
+
+    /**
+     * @brief Remove the oldest event from the front of the queue, merging any DRAGGED events that follow a DRAGGED 
+     * event. Consumer only.
+     * 
+     * @param event Set to the removed event
+     * @return true An event was removed
+     * @return false The queue is empty
+     */
+    bool pop(TouchEvent_s& event) {
+        uint8_t h = head.load(std::memory_order_relaxed);
+        uint8_t t = tail.load(std::memory_order_acquire);
+        if ( h == t ) return false;
+        event = events[h];
+        h = increment(h);
+        while ( event.type == InputEventType::DRAGGED && h != t && events[h].type == InputEventType::DRAGGED ) {
+            event.touchPoint = events[h].touchPoint;
+            event.clickCount = events[h].clickCount;
+            event.longPressCount = events[h].longPressCount;
+            h = increment(h);
+        }
+        head.store(h, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Remove all events, including any held by the producer (does not reset `dropped()`). Consumer only.
+     * 
+     */
+    void clear() {
+        cleared.store(true, std::memory_order_release);
+        head.store(tail.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    /**
+     * @brief The number of queued events (before coalescing). May be out of date as soon as it is returned.
+     * 
+     * @return uint8_t 
+     */
+    uint8_t size() const {
+        uint8_t h = head.load(std::memory_order_acquire);
+        uint8_t t = tail.load(std::memory_order_acquire);
+        return static_cast<uint8_t>(t >= h ? t - h : Slots - h + t);
+    }
+
+    /**
+     * @brief Returns true if no events are queued
+     * 
+     * @return true 
+     * @return false 
+     */
+    bool empty() const { return size() == 0; }
+
+    /**
+     * @brief The number of events dropped because the queue was full
+     * 
+     * @return uint16_t 
+     */
+    uint16_t dropped() const { return droppedCount.load(std::memory_order_relaxed); }
+
+    private:
+
+    static_assert(Capacity > 0 && Capacity < 255, "AtomicTouchEventQueue Capacity must be 1-254");
+    static constexpr uint8_t Slots = Capacity + 1; //One slot is always empty so full and empty differ
+    static constexpr uint8_t Reserved = Capacity > 1 ? 1 : 0; //Free slots kept for events that end a touch
+
+    static uint8_t increment(uint8_t i) { return static_cast<uint8_t>(i + 1 == Slots ? 0 : i + 1); }
+
+    static bool endsTouch(InputEventType type) {
+        return type == InputEventType::RELEASED || type == InputEventType::DRAGGED_RELEASED;
+    }
+
+    //Producer only: publish event if more than reserve slots are free
+    bool publish(const TouchEvent_s& event, uint8_t reserve) {
+        uint8_t t = tail.load(std::memory_order_relaxed);
+        uint8_t h = head.load(std::memory_order_acquire);
+        uint8_t used = static_cast<uint8_t>(t >= h ? t - h : Slots - h + t);
+        if ( Capacity - used <= reserve ) return false;
+        events[t] = event;
+        tail.store(increment(t), std::memory_order_release);
+        return true;
+    }
+
+    //Producer only
+    void countDropped() {
+        uint16_t d = droppedCount.load(std::memory_order_relaxed);
+        if ( d < 0xFFFF ) droppedCount.store(d + 1, std::memory_order_relaxed);
+    }
+
+    //Producer only: forget the held DRAGGED and any skipped touch after the consumer's clear()
+    void discardIfCleared() {
+        if ( cleared.load(std::memory_order_relaxed) && cleared.exchange(false, std::memory_order_acquire) ) {
+            hasPending = false;
+            skipTouch = false;
+        }
+    }
+
+    TouchEvent_s events[Slots];
+    std::atomic<uint8_t> head{0}; //Written by the consumer
+    std::atomic<uint8_t> tail{0}; //Written by the producer
+    std::atomic<uint16_t> droppedCount{0};
+    std::atomic<bool> cleared{false}; //Set by the consumer's clear()
+    TouchEvent_s pending; //Producer only: the DRAGGED waiting for room
+    bool hasPending = false; //Producer only
+    bool skipTouch = false; //Producer only: the PRESSED of the current touch was dropped
+
+};
+
+} //namespace
+
+#endif
+#endif
+
+#endif
@@ -0,0 +1,148 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+#ifndef INPUT_EVENTS_CALLBACK_DELEGATE_H
+#define INPUT_EVENTS_CALLBACK_DELEGATE_H
+
+#include <Arduino.h>
+#include <string.h>
+
+namespace input_events {
+
+/**
+ * @brief A fixed size callback that holds either a function pointer or an instance plus class method, without
+ * heap allocation. Used as the default callback type of EventTouchScreen and EventWidgetMixin.
+ * 
+ * @details The instance and method are stored inline and called via a small 'trampoline' function, so invoking the 
+ * callback is a single indirect call. Non-capturing lambdas are converted to a function pointer. Capturing lambdas
+ * are not supported - define <code>TOUCH_UI_USE_STD_FUNCTION</code> to use <code>std::function</code> instead.
+ * 
+ * @tparam Args The callback arguments
+ */
+template <typename... Args>
+class CallbackDelegate {
+
+    public:
+
+    /**
+     * @brief The plain function pointer type
+     */
+    typedef void (*FunctionPointer)(Args...);
+
+    /**
+     * @brief Construct an empty (unset) delegate
+     * 
+     */
+    CallbackDelegate() {}
+
+    /**
+     * @brief Construct an empty (unset) delegate - allows <code>callback = nullptr</code>
+     * 
+     */
+    CallbackDelegate(decltype(nullptr)) {}
+
+    /**
+     * @brief Construct a delegate for a function
+     * 
+     * @param f 
+     */
+    CallbackDelegate(FunctionPointer f) {
+        if ( f == nullptr ) return;
+        target.function = f;
+        trampoline = &callFunction;
+    }
+
+    /**
+     * @brief Construct a delegate from a non-capturing lambda
+     * 
+     * @param f 
+     */
+    template <typename F>
+    CallbackDelegate(F f) : CallbackDelegate(static_cast<FunctionPointer>(f)) {}
+
+    /**
+     * @brief Construct a delegate for a class method called on instance
+     * 
+     * @param instance 
+     * @param method 
+     */
+    template <typename T>
+    CallbackDelegate(T* instance, void (T::*method)(Args...)) {
+        static_assert(sizeof(method) <= sizeof(target.method), "Class method pointer is too large for CallbackDelegate");
+        if ( instance == nullptr || method == nullptr ) return;
+        object = instance;
+        memcpy(target.method, &method, sizeof(method));
+        trampoline = &callMethod<T>;
+    }
+
+    /**
+     * @brief Create a delegate for a class method that is known at compile time. The method is not stored, only the instance.
+     * 
+     * @details Usage: <code>CallbackDelegate<...>::bind<MyClass, &MyClass::onEvent>(&myInstance)</code>
+     * 
+     * @param instance 
+     * @return CallbackDelegate 
+     */
+    template <typename T, void (T::*Method)(Args...)>
+    static CallbackDelegate bind(T* instance) {
+        CallbackDelegate d;
+        if ( instance == nullptr ) return d;
+        d.object = instance;
+        d.trampoline = &callBoundMethod<T, Method>;
+        return d;
+    }
+
+    /**
+     * @brief Call the function or method. Must not be called if unset.
+     * 
+     * @param args 
+     */
+    void operator()(Args... args) const {
+        trampoline(*this, args...);
+    }
+
+    /**
+     * @brief Returns true if the delegate is set
+     * 
+     * @return true 
+     * @return false 
+     */
+    explicit operator bool() const { return trampoline != nullptr; }
+
+    private:
+
+    struct MethodHolder { void method(); };
+    typedef void (*Trampoline)(const CallbackDelegate&, Args...);
+
+    static void callFunction(const CallbackDelegate& d, Args... args) {
+        d.target.function(args...);
+    }
+
+    template <typename T>
+    static void callMethod(const CallbackDelegate& d, Args... args) {
+        void (T::*method)(Args...);
+        memcpy(&method, d.target.method, sizeof(method));
+        (static_cast<T*>(d.object)->*method)(args...);
+    }
+
+    template <typename T, void (T::*Method)(Args...)>
+    static void callBoundMethod(const CallbackDelegate& d, Args... args) {
+        (static_cast<T*>(d.object)->*Method)(args...);
+    }
+
+    void* object = nullptr;
+    union {
+        FunctionPointer function;
+        unsigned char method[sizeof(void (MethodHolder::*)())];
+    } target = {};
+    Trampoline trampoline = nullptr;
+
+};
+
+} //namespace
+#endif
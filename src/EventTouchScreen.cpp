@@ -26,6 +26,9 @@ void EventTouchScreen::unsetCallback() {
 }
 
 void EventTouchScreen::update() {
+    #if defined(TOUCH_SCREEN_THREADED) && TOUCH_SCREEN_EVENT_QUEUE_SIZE > 0
+    if ( queueEnabled ) eventQueue.flush(); //Publish a held DRAGGED once processEventQueue() has made room
+    #endif
     if (_enabled) {
         if( millis() > (rateLimitCounter + rateLimit) ) { 
             rateLimitCounter = millis();
@@ -103,10 +106,39 @@ void EventTouchScreen::update() {
 
 void EventTouchScreen::invoke(InputEventType et) {
     if ( isInvokable(et) ) {
+        #if TOUCH_SCREEN_EVENT_QUEUE_SIZE > 0
+        if ( queueEnabled ) {
+            TouchEvent_s event;
+            event.type = et;
+            event.touchPoint = sampledTouchPoint(); //Not getTouchPoint(), replayEvent belongs to the consumer
+            event.startTouchPoint = startTouchPoint;
+            event.previousTouchPoint = previousTouchPoint;
+            event.clickCount = prevClickCount;
+            event.longPressCount = longPressCounter;
+            eventQueue.push(event);
+            return;
+        }
+        #endif
         callbackFunction(et, *this);
     }    
 }
 
+#if TOUCH_SCREEN_EVENT_QUEUE_SIZE > 0
+uint8_t EventTouchScreen::processEventQueue(uint8_t maxEvents) {
+    uint8_t processed = 0;
+    TouchEvent_s event;
+    while ( (maxEvents == 0 || processed < maxEvents) && eventQueue.pop(event) ) {
+        if ( callbackFunction ) {
+            replayEvent = &event;
+            callbackFunction(event.type, *this);
+            replayEvent = nullptr;
+        }
+        processed++;
+    }
+    return processed;
+}
+#endif
+
 void EventTouchScreen::onDisabled() {
     //Reset button state
     clickCounter = 0;
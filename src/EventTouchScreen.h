@@ -13,7 +13,25 @@
 
 #include "InputEvents.h"
 #include "EventInputBase.h"
+#include "CallbackDelegate.h"
 #include "TouchScreenAdapter/BaseTouchScreenAdapter.h"
+#include "TouchEventQueue.h"
+
+#ifndef TOUCH_SCREEN_EVENT_QUEUE_SIZE
+#if defined(__AVR__)
+#define TOUCH_SCREEN_EVENT_QUEUE_SIZE 0
+#else
+/**
+ * @brief The size of the (optional) EventTouchScreen event queue. Set to 0 to exclude the queue.
+ */
+#define TOUCH_SCREEN_EVENT_QUEUE_SIZE 8
+#endif
+#endif
+
+#if defined(TOUCH_SCREEN_THREADED) && TOUCH_SCREEN_EVENT_QUEUE_SIZE > 0
+//TOUCH_SCREEN_THREADED must be a build flag so it is also seen by EventTouchScreen.cpp - see TouchSamplerTask.h
+#include "AtomicTouchEventQueue.h"
+#endif
 
 namespace input_events {
 
@@ -25,16 +43,16 @@ class EventTouchScreen : public EventInputBase {
 
     protected:
 
-    #if defined(FUNCTIONAL_SUPPORTED)
+    #if defined(FUNCTIONAL_SUPPORTED) && defined(TOUCH_UI_USE_STD_FUNCTION)
     /**
-     * @brief If <code>std::function</code> is supported, use to create the callback type.
+     * @brief If <code>std::function</code> is supported and <code>TOUCH_UI_USE_STD_FUNCTION</code> is defined, use to create the callback type.
      */
     typedef std::function<void(InputEventType et, EventTouchScreen &ts)> CallbackFunction;
     #else
     /**
-     * @brief Create the callback type as pointer if <code>std::function</code> is not supported.
+     * @brief By default the callback is a CallbackDelegate which holds a function or class method without heap allocation.
      */
-    typedef void (*CallbackFunction)(InputEventType et, EventTouchScreen &);
+    typedef CallbackDelegate<InputEventType, EventTouchScreen &> CallbackFunction;
     #endif
 
     /**
@@ -73,23 +91,21 @@ class EventTouchScreen : public EventInputBase {
     /**
      * @brief Set the Callback function to a class method.
      * 
-     * @details Note: This method is only available if <code>std:function</code> is supported.
-     * 
-     * 
      * @param instance The instance of a class implementing a CallbackFunction method.
      * @param method The class method of type <code>EventTouchScreen::CallbackFunction</code> type.
      */
-    #if defined(FUNCTIONAL_SUPPORTED)
-    // Method to set callback with instance and class method
     template <typename T>
     void setCallback(T* instance, void (T::*method)(InputEventType, EventTouchScreen&)) {
+        #if defined(FUNCTIONAL_SUPPORTED) && defined(TOUCH_UI_USE_STD_FUNCTION)
         // Wrap the method call in a lambda
         callbackFunction = [instance, method](InputEventType et, EventTouchScreen& ie) {
             (instance->*method)(et, ie); // Call the member function on the instance
         };
+        #else
+        callbackFunction = CallbackFunction(instance, method);
+        #endif
         callbackIsSet = true;
     }
-    #endif
 
     /**
      * @brief Unset a previously set callback function or method.
@@ -107,6 +123,55 @@ class EventTouchScreen : public EventInputBase {
      */
     void update();
 
+    #if TOUCH_SCREEN_EVENT_QUEUE_SIZE > 0
+    /**
+     * @brief Enable the event queue. When enabled, events are not passed to the callback from within
+     * <code>update()</code> but are queued until <code>processEventQueue()</code> is called.
+     * 
+     * @details Consecutive DRAGGED events are merged into the newest one, retaining the original start and previous 
+     * touch points, so a slow DRAGGED handler only ever sees the latest drag position.
+     * 
+     * The touch point getters, <code>clickCount()</code> and <code>longPressCount()</code> return the values 
+     * captured when the event fired while the queued event is being passed to the callback.
+     * 
+     * The queue holds <code>TOUCH_SCREEN_EVENT_QUEUE_SIZE</code> events (default 8). If full, DRAGGED and other events 
+     * are dropped before PRESSED, RELEASED and DRAGGED_RELEASED, so a touch is never left without its end (see 
+     * TouchEventQueue and, if <code>TOUCH_SCREEN_THREADED</code> is defined, AtomicTouchEventQueue).
+     * 
+     * If <code>TOUCH_SCREEN_THREADED</code> is defined, the queue is lock-free so update() can be called from another
+     * task (see TouchSamplerTask). Enable the queue before that task is started.
+     * 
+     * @param enable True (default) to enable, false to disable. Disabling clears the queue.
+     */
+    void enableEventQueue(bool enable = true) { 
+        queueEnabled = enable;
+        if ( !enable ) eventQueue.clear();
+    }
+
+    /**
+     * @brief Returns true if the event queue is enabled
+     */
+    bool isEventQueueEnabled() { return queueEnabled; }
+
+    /**
+     * @brief Pass queued events to the callback function, oldest first.
+     * 
+     * @param maxEvents The maximum number of events to process. 0 (default) processes all queued events.
+     * @return uint8_t The number of events processed
+     */
+    uint8_t processEventQueue(uint8_t maxEvents = 0);
+
+    /**
+     * @brief The number of events waiting in the queue
+     */
+    uint8_t queuedEventCount() { return eventQueue.size(); }
+
+    /**
+     * @brief The number of events dropped because the queue was full
+     */
+    uint16_t droppedEventCount() { return eventQueue.dropped(); }
+    #endif
+
     /**
      * @brief Set the interval in ms between double, triple or
      * multi clicks
@@ -134,14 +199,24 @@ class EventTouchScreen : public EventInputBase {
     /**
      * @brief The number of multi-clicks that have been fired in the clicked event
      */
-    unsigned char clickCount() { return prevClickCount; }
+    unsigned char clickCount() { 
+        #if TOUCH_SCREEN_EVENT_QUEUE_SIZE > 0
+        if ( replayEvent ) return replayEvent->clickCount;
+        #endif
+        return prevClickCount; 
+    }
 
 
     /**
      * @brief The number of times the long press handler has  been fired in the 
      * button pressed event
      */
-    uint8_t longPressCount() { return longPressCounter; }
+    uint8_t longPressCount() { 
+        #if TOUCH_SCREEN_EVENT_QUEUE_SIZE > 0
+        if ( replayEvent ) return replayEvent->longPressCount;
+        #endif
+        return longPressCounter; 
+    }
 
     /**
      * @brief Returns true if touch screen is pressed/touched
@@ -259,18 +334,22 @@ class EventTouchScreen : public EventInputBase {
      * @return TouchPoint_s 
      */
     TouchPoint_s getTouchPoint() { 
-        if ( touchPoint.z == 0 ) { 
-            touchPoint = lastTouchedPoint;
-            touchPoint.z = 0;
-        }
-        return touchPoint; 
+        #if TOUCH_SCREEN_EVENT_QUEUE_SIZE > 0
+        if ( replayEvent ) return replayEvent->touchPoint;
+        #endif
+        return sampledTouchPoint();
     }
     /**
      * @brief Get the Previous TouchPoint_s struct
      * 
      * @return TouchPoint_s 
      */
-    TouchPoint_s getPreviousTouchPoint() { return previousTouchPoint; }
+    TouchPoint_s getPreviousTouchPoint() { 
+        #if TOUCH_SCREEN_EVENT_QUEUE_SIZE > 0
+        if ( replayEvent ) return replayEvent->previousTouchPoint;
+        #endif
+        return previousTouchPoint; 
+    }
 
     /**
      * @brief Get the starting TouchPoint_s struct
@@ -279,7 +358,12 @@ class EventTouchScreen : public EventInputBase {
      * 
      * @return TouchPoint_s 
      */
-    TouchPoint_s getStartTouchPoint() { return startTouchPoint; }
+    TouchPoint_s getStartTouchPoint() { 
+        #if TOUCH_SCREEN_EVENT_QUEUE_SIZE > 0
+        if ( replayEvent ) return replayEvent->startTouchPoint;
+        #endif
+        return startTouchPoint; 
+    }
 
     /**
      * @brief Get the TouchAdapter for this screen
@@ -330,6 +414,27 @@ class EventTouchScreen : public EventInputBase {
      */
     bool debounced();
 
+    /**
+     * @brief The current touch point, ignoring any queued event being passed to the callback. If Z is 0, 
+     * the last known touched point with Z set to 0.
+     * 
+     * @return TouchPoint_s 
+     */
+    TouchPoint_s sampledTouchPoint() {
+        if ( touchPoint.z == 0 ) { 
+            touchPoint = lastTouchedPoint;
+            touchPoint.z = 0;
+        }
+        return touchPoint; 
+    }
+
+    #if TOUCH_SCREEN_EVENT_QUEUE_SIZE > 0
+    /**
+     * @brief Set while a queued event is being passed to the callback so the getters return the queued values.
+     */
+    const TouchEvent_s* replayEvent = nullptr;
+    #endif
+
 
 
 private:
@@ -377,6 +482,15 @@ private:
     uint16_t dragIntervalMs = 100;
     uint16_t postDragRateLimit = 500;
 
+    #if TOUCH_SCREEN_EVENT_QUEUE_SIZE > 0
+    bool queueEnabled = false;
+    #if defined(TOUCH_SCREEN_THREADED)
+    AtomicTouchEventQueue<TOUCH_SCREEN_EVENT_QUEUE_SIZE> eventQueue;
+    #else
+    TouchEventQueue<TOUCH_SCREEN_EVENT_QUEUE_SIZE> eventQueue;
+    #endif
+    #endif
+
 };
 
 }
@@ -0,0 +1,180 @@
+#ifndef INPUT_EVENTS_BAND_TRANSITION_RENDERER_H
+#define INPUT_EVENTS_BAND_TRANSITION_RENDERER_H
+
+#if defined(__has_include)
+#if __has_include(<vector>) && __has_include(<string>) //Check if std lib is supported
+
+#include <Arduino.h>
+#include "EventScreenManager.h"
+#include "ui/BandCanvas.h"
+#include "ui/ClipStack.h"
+
+namespace input_events {
+
+/** \ingroup ScreenManager
+ *  @{
+ */
+
+/**
+ * @brief An ITransitionRenderer that draws slides, wipes and fades off-screen, one horizontal band at a time (like
+ * `BandRenderer`), and writes each band to the display as a single block, so there is no flicker.
+ * 
+ * @details Each band is filled with the background colour, then both screens draw into it with
+ * `IManagedScreen::drawTransitionBand()`. For a Slide, each screen is drawn at its offset. For a Wipe, each
+ * screen is clipped to its side of the edge. A Fade fades the screen being left to the background colour, then
+ * fades the screen being entered in from it. The clipStack() holds the visible part of the band in the screen's
+ * own coordinates, so icons outside it are skipped.
+ * 
+ * The band height is BufferPixels / width of the area, eg `BandTransitionRenderer<320 * 16>` uses 10KB of RAM
+ * for a 320 pixel wide screen:
+ * ```
+ * void pushBlock(const input_events::Region& r, const uint16_t* pixels) {
+ *     tft.pushImage(r.x(), r.y(), r.w(), r.h(), pixels);
+ * }
+ * input_events::BandTransitionRenderer<320 * 16> transitionRenderer(screenManager, input_events::Region(0, 0, 320, 240), pushBlock);
+ * 
+ * void setup() {
+ *     screenManager.setTransition(&transitionRenderer, input_events::TransitionStyle::SlideLeft, 250);
+ * }
+ * ```
+ * 
+ * @tparam BufferPixels The size of the band buffer in pixels
+ */
+template<size_t BufferPixels>
+class BandTransitionRenderer : public ITransitionRenderer {
+
+    public:
+
+    /**
+     * @brief Construct a BandTransitionRenderer
+     * 
+     * @param manager The screen manager, to get the screens of each frame
+     * @param area The Region of the display the screens occupy (usually the whole display)
+     * @param writer The function or method that writes a block of pixels to the display
+     */
+    BandTransitionRenderer(EventScreenManager& manager, const Region& area, PixelBlockWriter writer) :
+        manager(manager),
+        area(area),
+        writer(writer)
+        {}
+
+    /**
+     * @brief Set the colour each band is filled with before the screens are drawn, and faded to by a Fade
+     * 
+     * @param colour 
+     */
+    void setBgColour(uint16_t colour) { bgColour = colour; }
+
+    /**
+     * @brief Draw a frame of the transition, band by band
+     * 
+     * @param frame 
+     */
+    void drawTransitionFrame(const TransitionFrame& frame) override {
+        uint16_t lines = static_cast<uint16_t>(area.w() == 0 ? 0 : BufferPixels / area.w());
+        if ( lines == 0 ) return;
+        IManagedScreen* from = manager.getScreen(frame.from);
+        IManagedScreen* to = manager.getScreen(frame.to);
+        for (uint32_t y = area.y(); y <= area.b(); y += lines) {
+            uint16_t h = static_cast<uint16_t>((area.b() - y + 1) < lines ? (area.b() - y + 1) : lines);
+            Region band(area.x(), static_cast<uint16_t>(y), area.w(), h);
+            canvas.begin(buffer, band);
+            canvas.fill(bgColour);
+            switch (frame.style) {
+                case TransitionStyle::WipeLeft :
+                case TransitionStyle::WipeRight : {
+                    uint16_t edge = static_cast<uint16_t>(area.x() + frame.wipeX(area.w()));
+                    Region left(area.x(), band.y(), static_cast<uint16_t>(edge - area.x()), h);
+                    Region right(edge, band.y(), static_cast<uint16_t>(area.r() + 1 - edge), h);
+                    bool nextOnRight = frame.style == TransitionStyle::WipeLeft;
+                    drawScreen(from, nextOnRight ? left : right, 0, 0);
+                    drawScreen(to, nextOnRight ? right : left, 0, 0);
+                    break;
+                }
+                case TransitionStyle::Fade : {
+                    uint8_t alpha = frame.alpha();
+                    if ( alpha < 128 ) { //Fade out
+                        drawScreen(from, band, 0, 0);
+                        fadeBand(static_cast<uint8_t>(255 - alpha * 2));
+                    } else { //Fade in
+                        drawScreen(to, band, 0, 0);
+                        fadeBand(static_cast<uint8_t>((alpha - 128) * 2 + 1));
+                    }
+                    break;
+                }
+                default : //Slides
+                    drawScreen(from, band, frame.fromX(area.w()), frame.fromY(area.h()));
+                    drawScreen(to, band, frame.toX(area.w()), frame.toY(area.h()));
+                    break;
+            }
+            if ( writer ) writer(band, buffer);
+        }
+    }
+
+    /**
+     * @brief Blend two RGB565 colours
+     * 
+     * @param fg 
+     * @param bg 
+     * @param alpha 0 is bg, 255 is fg
+     * @return uint16_t 
+     */
+    static uint16_t blend(uint16_t fg, uint16_t bg, uint8_t alpha) {
+        uint32_t a = (static_cast<uint32_t>(alpha) + 4) >> 3; //0 to 32
+        uint32_t f = (fg | (static_cast<uint32_t>(fg) << 16)) & 0x07E0F81FUL; //Green in the top half, red and blue in the bottom
+        uint32_t b = (bg | (static_cast<uint32_t>(bg) << 16)) & 0x07E0F81FUL;
+        uint32_t result = ((f * a + b * (32 - a)) >> 5) & 0x07E0F81FUL;
+        return static_cast<uint16_t>(result | (result >> 16));
+    }
+
+    private:
+
+    //Draw screen into the band, clipped to region (display coordinates) and offset by dx, dy
+    void drawScreen(IManagedScreen* screen, const Region& region, int16_t dx, int16_t dy) {
+        if ( screen == nullptr || region.w() == 0 || region.h() == 0 ) return;
+        if ( canvas.setClip(region) ) {
+            //The visible part of the band in the screen's coordinates, for icons that check the clipStack()
+            const Region& visible = canvas.getClip();
+            int32_t x0 = visible.x() - dx;
+            int32_t y0 = visible.y() - dy;
+            int32_t x1 = x0 + visible.w();
+            int32_t y1 = y0 + visible.h();
+            if ( x0 < 0 ) x0 = 0;
+            if ( y0 < 0 ) y0 = 0;
+            if ( x1 > x0 && y1 > y0 ) {
+                ClipScope clip(Region(static_cast<uint16_t>(x0), static_cast<uint16_t>(y0),
+                    static_cast<uint16_t>(x1 - x0), static_cast<uint16_t>(y1 - y0)));
+                canvas.setOrigin(dx, dy);
+                screen->drawTransitionBand(canvas);
+                canvas.setOrigin(0, 0);
+            }
+        }
+        canvas.resetClip();
+    }
+
+    //Blend every pixel of the band with the background colour
+    void fadeBand(uint8_t alpha) {
+        const Region& band = canvas.getRegion();
+        size_t count = static_cast<size_t>(band.w()) * band.h();
+        for (size_t i = 0; i < count; ++i) {
+            buffer[i] = blend(buffer[i], bgColour, alpha);
+        }
+    }
+
+    EventScreenManager& manager;
+    Region area;
+    PixelBlockWriter writer;
+    BandCanvas canvas;
+    uint16_t bgColour = 0x0000;
+    uint16_t buffer[BufferPixels];
+
+};
+
+/** @}*/
+
+} // namespace
+
+#endif
+#endif
+
+#endif
@@ -4,11 +4,33 @@
 #if defined(__has_include)
 #if __has_include(<vector>) && __has_include(<string>) //Check if std lib is supported
 
+#ifndef SCREEN_MANAGER_MAX_SCREENS
+/**
+ * @brief The maximum number of screens that can be registered with EventScreenManager (max 255)
+ */
+#define SCREEN_MANAGER_MAX_SCREENS 16
+#endif
+
+#ifndef SCREEN_MANAGER_HISTORY_SIZE
+/**
+ * @brief The maximum number of screens in the EventScreenManager history (for Back). When full, the oldest is dropped.
+ */
+#define SCREEN_MANAGER_HISTORY_SIZE 8
+#endif
+
+#ifndef SCREEN_MANAGER_KEEP_ALIVE_MS
+/**
+ * @brief The default maximum time in ms between draw() calls when the current screen's needsDraw() returns false (0 to disable)
+ */
+#define SCREEN_MANAGER_KEEP_ALIVE_MS 1000
+#endif
+
 #include <Arduino.h>
-#include <unordered_map>
+#include <vector>
 #include <string>
 #include "IScreenRouter.h"
 #include "IManagedScreen.h"
+#include "ITransitionRenderer.h"
 
 
 namespace input_events {
@@ -20,11 +42,22 @@ namespace input_events {
 /**
  * @brief A ScreenManager for frameworks the support the std lib (not currently AVR)
  * 
+ * @details Screens are held in a fixed size registry (SCREEN_MANAGER_MAX_SCREENS) and each has a ScreenHandle (its index). 
+ * Look up handles by id once during setup with getHandle(), then use the handle methods for transitions and 
+ * checks - these do not compare strings or allocate.
+ * 
+ * Each transition (except Back, Replace and Init) adds the current screen to a fixed size history 
+ * (SCREEN_MANAGER_HISTORY_SIZE), with the value of its saveState(). Back returns to the last screen in the history 
+ * and passes it the saved state with restoreState(), unless a router redirects.
+ * 
  */
 class EventScreenManager {
 
 public:
 
+    static_assert(SCREEN_MANAGER_MAX_SCREENS < 255, "SCREEN_MANAGER_MAX_SCREENS must be less than 255");
+    static_assert(SCREEN_MANAGER_HISTORY_SIZE > 0 && SCREEN_MANAGER_HISTORY_SIZE < 256, "SCREEN_MANAGER_HISTORY_SIZE must be 1 to 255");
+
 
     /**
      * @brief Construct a new EventScreenManager
@@ -40,23 +73,194 @@ public:
      */
     void begin() { 
         pendingIntent = { TransitionIntentType::Init };
+        nextFrameMicros = micros(); //The first frame is due now, whenever begin() is called
+        fpsWindowStart = nextFrameMicros; //Measure the achieved FPS from the first frame, not from boot
+        fpsFrames = 0;
     }
 
     /**
-     * @brief Called from loo(). Checks if a screen transition has been requested and calls current screen's draw() at set FPS.
+     * @brief Called from loop(). Checks if a screen transition has been requested and calls current screen's draw() at 
+     * no more than the set FPS, and only if its needsDraw() returns true or the keep alive has expired. Between frames, 
+     * prepares one likely next screen (see `IManagedScreen::prepare()`).
      * 
      */
     void update() {
         if ( pendingIntent.type != TransitionIntentType::None ) {
+            if ( transitioning ) finishTransition(); //Interrupted
             resolveTransition(pendingIntent);
             pendingIntent = {};
         }
         now = millis();
-        if ((uint32_t)(now - lastDisplayRefresh) < displayRefreshMs) return;
-        lastDisplayRefresh = now;
-        if (current) current->draw();
+        uint32_t nowMicros = micros();
+        if ( (int32_t)(nowMicros - nextFrameMicros) < 0 ) {
+            if ( !transitioning ) prepareNext(); //Idle frame
+            return;
+        }
+        if ( transitioning ) {
+            frameStarted(nowMicros);
+            drawTransitionFrame();
+            return;
+        }
+        if ( !current ) return;
+        if ( !current->needsDraw() && !isKeepAliveDue() ) {
+            nextFrameMicros = nowMicros; //Draw as soon as needed
+            prepareNext(); //Nothing to draw
+            return;
+        }
+        frameStarted(nowMicros);
+        current->draw();
+    }
+
+    /**
+     * @brief Set the maximum time between draw() calls when the current screen's needsDraw() returns false.
+     * 
+     * @param ms 0 to only draw when needsDraw() returns true
+     */
+    void setKeepAlive(uint16_t ms) { keepAliveMs = ms; }
+
+    /**
+     * @brief Get the keep alive time in ms
+     * 
+     * @return uint16_t 
+     */
+    uint16_t getKeepAlive() const { return keepAliveMs; }
+
+    /**
+     * @brief Returns true if there is nothing for update() to do until the current screen needs drawing or the 
+     * keep alive expires (no pending request, transition or screen to prepare). The app can then sleep for up to 
+     * msToNextFrame(), as long as a touch (or other input) wakes it.
+     * 
+     * @return true 
+     * @return false 
+     */
+    bool isIdle() {
+        if ( pendingIntent.type != TransitionIntentType::None || transitioning ) return false;
+        for (uint8_t i = 0; i < PREPARE_QUEUE_SIZE; ++i) {
+            if ( prepareQueue[i] != InvalidScreenHandle ) return false;
+        }
+        return current == nullptr || !current->needsDraw();
+    }
+
+    /**
+     * @brief Returns the number of ms until update() next needs to draw: 0 if a frame is due now, the time until
+     * the next frame if the screen needs drawing, otherwise the time until the keep alive expires. If there is 
+     * no current screen or the keep alive is 0 and nothing needs drawing, returns UINT32_MAX.
+     * 
+     * @return uint32_t 
+     */
+    uint32_t msToNextFrame() {
+        bool needed = transitioning || pendingIntent.type != TransitionIntentType::None 
+            || (current && current->needsDraw());
+        if ( needed ) {
+            int32_t untilFrame = (int32_t)(nextFrameMicros - micros());
+            return untilFrame <= 0 ? 0 : ((uint32_t)untilFrame + 999) / 1000;
+        }
+        if ( current == nullptr || keepAliveMs == 0 ) return UINT32_MAX;
+        uint32_t sinceRefresh = millis() - lastDisplayRefresh;
+        return sinceRefresh >= keepAliveMs ? 0 : keepAliveMs - sinceRefresh;
+    }
+
+    /**
+     * @brief Set the renderer and style of animated transitions between screens. Back transitions use the reverse style.
+     * 
+     * @details A transition is drawn over several update() calls, one frame at the set FPS, so loop() (and touch 
+     * sampling) is never blocked for the whole duration. Progress is calculated from the elapsed time, so if 
+     * drawing is slow, frames are skipped rather than the transition taking longer. Pass TransitionStyle::None 
+     * (or a nullptr renderer) to switch screens immediately.
+     * 
+     * @param renderer 
+     * @param style 
+     * @param durationMs 
+     */
+    void setTransition(ITransitionRenderer* renderer, TransitionStyle style = TransitionStyle::SlideLeft, uint16_t durationMs = 250) {
+        transitionRenderer = renderer;
+        transitionStyle = style;
+        transitionMs = durationMs;
+    }
+
+    /**
+     * @brief Returns true while an animated transition is being drawn. The next screen is current (see 
+     * getCurrentHandle()) but not yet started, and getCurrent() returns nullptr.
+     * 
+     * @return true 
+     * @return false 
+     */
+    bool isTransitioning() const { return transitioning; }
+
+    /**
+     * @brief Request that a screen is prepared during the next idle frame (if not already prepared)
+     * 
+     * @param handle 
+     */
+    void prepareScreen(ScreenHandle handle) {
+        if ( handle >= screenCount || handle == currentHandle || isPrepared(handle) ) return;
+        for (uint8_t i = 0; i < PREPARE_QUEUE_SIZE; ++i) {
+            if ( prepareQueue[i] == handle ) return;
+            if ( prepareQueue[i] == InvalidScreenHandle ) {
+                prepareQueue[i] = handle;
+                return;
+            }
+        }
+    }
+
+    /**
+     * @brief Returns true if the screen has been prepared and not started since
+     * 
+     * @param handle 
+     * @return true 
+     * @return false 
+     */
+    bool isPrepared(ScreenHandle handle) const {
+        return handle < screenCount && (prepared[handle / 8] & (1 << (handle % 8)));
+    }
+
+    /**
+     * @brief Get the screen that Back will return to (without a router redirect)
+     * 
+     * @return ScreenHandle or InvalidScreenHandle if the history is empty
+     */
+    ScreenHandle getBackHandle() const {
+        return historyCount == 0 ? InvalidScreenHandle : history[historyIndex(historyCount - 1)];
+    }
+
+    /**
+     * @brief Get the screen at depth in the history, 0 being the screen Back will return to
+     * 
+     * @param depth 
+     * @return ScreenHandle or InvalidScreenHandle
+     */
+    ScreenHandle getHistoryHandle(uint8_t depth) const {
+        return depth >= historyCount ? InvalidScreenHandle : history[historyIndex(historyCount - 1 - depth)];
     }
 
+    /**
+     * @brief Return the number of screens in the history
+     * 
+     * @return uint8_t 
+     */
+    uint8_t getHistoryDepth() const { return historyCount; }
+
+    /**
+     * @brief Clear the history, eg when returning to a home screen
+     * 
+     */
+    void clearHistory() { historyCount = 0; }
+
+    /**
+     * @brief Request a transition back to the last screen in the history. A router may redirect.
+     * 
+     */
+    void requestBack() {
+        requestScreen( { TransitionIntentType::Back } );
+    }
+
+    /**
+     * @brief The time taken by the last transition (the previous screen's end() and next screen's start(), excluding any animation) in microseconds
+     * 
+     * @return uint32_t 
+     */
+    uint32_t getLastTransitionMicros() const { return lastTransitionMicros; }
+
     /**
      * @brief Register an IManagedScreen. Uses screen's name() if id is not provided.
      * 
@@ -66,11 +270,12 @@ public:
      * @return false 
      */
     bool registerScreen(IManagedScreen* screen, std::string id = {} ) {
+        if ( screen == nullptr ) return false;
         id = ( id.empty() ? screen->name() : id );
         if ( id.empty() ) return false; //In case of empty name() and id
-        if ( screens.empty() ) initialScreen = id;
-        auto result = screens.emplace(id, screen);
-        if (!result.second) return false; //Already exists
+        if ( getHandle(id) != InvalidScreenHandle ) return false; //Already exists
+        if ( screenCount >= SCREEN_MANAGER_MAX_SCREENS ) return false; //Full
+        screens[screenCount++] = screen; //The first registered screen (handle 0) is the initial screen
         screen->setId(id);
         screen->begin();
         return true;
@@ -85,14 +290,45 @@ public:
      * @return false 
      */
     bool overwriteScreen(IManagedScreen* screen, std::string id = {} ) {
+        if ( screen == nullptr ) return false;
         id = ( id.empty() ? screen->name() : id );
         if ( id.empty() ) return false; //In case of empty name() and id
-        screens[id] = screen; //Overwrite
+        ScreenHandle handle = getHandle(id);
+        if ( handle == InvalidScreenHandle ) return registerScreen(screen, id);
+        if ( handle == currentHandle ) current = screen;
+        screens[handle] = screen; //Overwrite
+        setPrepared(handle, false);
         screen->setId(id);
         screen->begin();
         return true;
     }
 
+    /**
+     * @brief Get the handle of a registered screen. Intended for setup - keep the handle for use in transitions.
+     * 
+     * @param id The name or id used to register the screen
+     * @return ScreenHandle or InvalidScreenHandle if not registered
+     */
+    ScreenHandle getHandle(const std::string& id) const {
+        for (uint8_t i = 0; i < screenCount; ++i) {
+            if ( screens[i]->id() == id ) return i;
+        }
+        return InvalidScreenHandle;
+    }
+
+    /**
+     * @brief Get the handle of a registered screen
+     * 
+     * @param screen 
+     * @return ScreenHandle or InvalidScreenHandle if not registered
+     */
+    ScreenHandle getHandle(const IManagedScreen* screen) const {
+        for (uint8_t i = 0; i < screenCount; ++i) {
+            if ( screens[i] == screen ) return i;
+        }
+        return InvalidScreenHandle;
+    }
+
     /**
      * @brief Add a new router for screen transitions. Routers are called in the order they are added. First to answer wins.
      * 
@@ -109,6 +345,17 @@ public:
      * @param nextScreen 
      */
     void requestScreen(const std::string& nextScreen) {
+        requestScreen(getHandle(nextScreen));
+    }
+
+    /**
+     * @brief Request a transition to a screen by handle. 
+     * 
+     * @details Will be passed to the screen routers (if any) for validation and/or redirect.
+     * 
+     * @param nextScreen 
+     */
+    void requestScreen(ScreenHandle nextScreen) {
         requestScreen( { TransitionIntentType::Next, nextScreen } );
     }
 
@@ -117,7 +364,7 @@ public:
      * 
      * @details The request will be passed to the screen routers (if any) for validation and/or redirect.
      * 
-     * @param intent Can be Init, Back, Next, Auto or a specific screen name. Screen router resolves screen name.
+     * @param intent Can be Init, Back, Next, Auto with an optional screen handle. Screen router resolves the screen.
      */
     void requestScreen(const TransitionIntent& intent) { 
         pendingIntent = intent; 
@@ -130,10 +377,18 @@ public:
      * @return IManagedScreen*  or nullptr if screen doesn't exist
      */
     IManagedScreen* getScreen(const std::string& id) {
-        auto it = screens.find(id);
-        if (it == screens.end()) return nullptr;
-        if ( !it->second ) return nullptr;
-        return it->second;
+        return getScreen(getHandle(id));
+    }
+
+    /**
+     * @brief Get a Screen object by handle (not necessarily the current one)
+     * 
+     * @param handle 
+     * @return IManagedScreen*  or nullptr if screen doesn't exist
+     */
+    IManagedScreen* getScreen(ScreenHandle handle) {
+        if ( handle >= screenCount ) return nullptr;
+        return screens[handle];
     }
 
     /**
@@ -144,10 +399,7 @@ public:
      * @return false Screen does not exist/
      */
     bool haveScreen(const std::string& id) {
-        auto it = screens.find(id);
-        if (it == screens.end()) return false;
-        if ( !it->second ) return false;
-        return true;
+        return getHandle(id) != InvalidScreenHandle;
     }
 
     /**
@@ -172,9 +424,18 @@ public:
      */
     bool isCurrent(const std::string& id) {
         if ( !current ) return false;
-        auto it = screens.find(id);
-        if (it == screens.end()) return false;
-        return ( it->second == current );
+        return current->id() == id;
+    }
+
+    /**
+     * @brief Return true if passed handle is that of the current screen
+     * 
+     * @param handle 
+     * @return true 
+     * @return false 
+     */
+    bool isCurrent(ScreenHandle handle) const {
+        return handle != InvalidScreenHandle && handle == currentHandle;
     }
 
     /**
@@ -199,18 +460,43 @@ public:
      */
     bool isPrevious(const std::string& id) {
         if ( !previous ) return false;
-        auto it = screens.find(id);
-        if (it == screens.end()) return false;
-        return ( it->second == previous );
+        return previous->id() == id;
     }
 
     /**
-     * @brief Get the current screen
+     * @brief Return true if passed handle is that of the previous screen
+     * 
+     * @param handle 
+     * @return true 
+     * @return false 
+     */
+    bool isPrevious(ScreenHandle handle) const {
+        return handle != InvalidScreenHandle && handle == previousHandle;
+    }
+
+    /**
+     * @brief Get the handle of the current screen
+     * 
+     * @return ScreenHandle or InvalidScreenHandle
+     */
+    ScreenHandle getCurrentHandle() const { return currentHandle; }
+
+    /**
+     * @brief Get the handle of the previous screen
+     * 
+     * @return ScreenHandle or InvalidScreenHandle
+     */
+    ScreenHandle getPreviousHandle() const { return previousHandle; }
+
+    /**
+     * @brief Get the current (started) screen. During an animated transition the next screen has not been 
+     * started, so this returns nullptr: route touch with `if (IManagedScreen* s = screenManager.getCurrent())` 
+     * so it is not sent to a screen before its start().
      * 
      * @return IManagedScreen* or nullptr
      */
     IManagedScreen* getCurrent() {
-        if (!current) return nullptr; 
+        if (!current || transitioning) return nullptr; 
         return current;
     }
 
@@ -226,72 +512,256 @@ public:
     }
 
     /**
-     * @brief Set the FPS (Frames Per Second) for draw() to be called
+     * @brief Set the maximum FPS (Frames Per Second) for draw() to be called, for screens without their own FPS
+     * 
+     * @details Frames are scheduled against a deadline that advances by exactly 1000000/fps µs, so the rate does 
+     * not drift with the time taken by update() or draw(). If a frame is more than one interval late, the schedule
+     * restarts from now rather than drawing a burst of frames to catch up.
      * 
-     * @param fps 
+     * @param fps 0 is ignored
      */
     void setFps(uint8_t fps) {
-        this->displayRefreshMs = (uint16_t)(1000/fps);
+        if ( fps > 0 ) defaultFps = fps;
     }
 
     /**
-     * @brief Get the currently set Fps
+     * @brief Set the maximum FPS for a screen, eg a high rate for a gauge and a low rate for a menu
      * 
+     * @param handle 
+     * @param fps 0 to use the FPS set with setFps(fps)
+     */
+    void setFps(ScreenHandle handle, uint8_t fps) {
+        if ( handle < screenCount ) screenFps[handle] = fps;
+    }
+
+    /**
+     * @brief Get the FPS set with setFps(fps)
+     * 
+     * @return uint8_t 
+     */
+    uint8_t getFps() const {
+        return defaultFps;
+    }
+
+    /**
+     * @brief Get the FPS used for a screen (its own FPS, or the FPS set with setFps(fps))
+     * 
+     * @param handle 
      * @return uint8_t 
      */
-    uint8_t getFps() {
-        return (uint8_t)(displayRefreshMs/1000);
+    uint8_t getFps(ScreenHandle handle) const {
+        return handle < screenCount && screenFps[handle] > 0 ? screenFps[handle] : defaultFps;
+    }
+
+    /**
+     * @brief Get the frame interval of the current screen in µs
+     * 
+     * @return uint32_t 
+     */
+    uint32_t getFrameMicros() const {
+        return 1000000UL / getFps(currentHandle);
+    }
+
+    /**
+     * @brief Get the number of frames (draw() or transition frames) actually drawn per second, measured over 
+     * about a second. With needsDraw(), this is lower than the set FPS while the screen is static.
+     * 
+     * @return uint16_t 
+     */
+    uint16_t getAchievedFps() const {
+        return achievedFps;
     }
 
 private:
 
     void resolveTransition(const TransitionIntent& intent) {
-        if ( screens.empty() ) return;
+        if ( screenCount == 0 ) return;
 
-        std::string resolved;
+        ScreenHandle resolved = InvalidScreenHandle;
 
         if ( routers.empty() ) {
             if ( intent.type == TransitionIntentType::Init ) { 
-                resolved = screens.empty() ? "" : initialScreen; //Init with first registered screen
+                resolved = 0; //Init with first registered screen
             }
         } else { // Ask routers in priority order for the next screen
             for (auto router : routers) {
-                resolved = router->resolveScreen(current ?  current->id() : std::string{}, intent);
-                if (!resolved.empty() ) break; // take the first valid result
+                resolved = router->resolveScreen(currentHandle, intent);
+                if ( resolved != InvalidScreenHandle ) break; // take the first valid result
                 if ( intent.type == TransitionIntentType::Init ) { //Should be resolved by first router, but if not, use first registered screen
-                    resolved = screens.empty() ? "" : initialScreen;
+                    resolved = 0;
                     break; //Only first router can resolve Init
                 }
             }
         }
 
-        if (resolved.empty() && !intent.requested.empty() ) { //No router complained, so just use the requested screen
+        bool fromHistory = false;
+        if ( resolved == InvalidScreenHandle && intent.type == TransitionIntentType::Back ) {
+            while ( historyCount > 0 && getBackHandle() == currentHandle ) { //eg A, B, then Replace with A
+                historyCount--;
+            }
+            if ( historyCount > 0 ) {
+                resolved = getBackHandle(); //No router redirect, so go back in the history
+                fromHistory = true;
+            }
+        }
+        if ( resolved == InvalidScreenHandle ) { //No router complained, so just use the requested screen
             resolved = intent.requested;
         }
-        if ( resolved.empty() ) return; //final sanity check
-        // Find the screen in the map
-        auto it = screens.find(resolved);
-        if (it == screens.end()) return; // Screen not registered
-        IManagedScreen* nextScreen = it->second;
+        if ( resolved >= screenCount ) return; //final sanity check - screen not registered
+        IManagedScreen* nextScreen = screens[resolved];
+        if (nextScreen == current) return; // Already on this screen
+        uint32_t startMicros = micros();
+        if ( fromHistory ) {
+            historyCount--;
+            nextScreen->restoreState(historyState[historyIndex(historyCount)]);
+        } else if ( current && intent.type != TransitionIntentType::Back && intent.type != TransitionIntentType::Replace ) {
+            pushHistory(currentHandle, current->saveState());
+        }
         if (current) {
-            if (nextScreen == current) return; // Already on this screen
             current->end();
             previous = current;
+            previousHandle = currentHandle;
+            setPrepared(currentHandle, false); //May have changed since prepared
         }
         current = nextScreen;
+        currentHandle = resolved;
+        lastTransitionMicros = micros() - startMicros;
+        if ( transitionRenderer && transitionStyle != TransitionStyle::None && transitionMs > 0 && previous ) {
+            transitionFrame.style = intent.type == TransitionIntentType::Back ? reverseTransition(transitionStyle) : transitionStyle;
+            transitionFrame.from = previousHandle;
+            transitionFrame.to = currentHandle;
+            transitionFrame.progress = 0;
+            transitionFrame.durationMs = transitionMs;
+            transitioning = true;
+            transitionRenderer->beginTransition(transitionFrame);
+            transitionStart = millis();
+            return; //start() is called when the transition is complete
+        }
+        startCurrent();
+    }
+
+    void startCurrent() {
+        uint32_t startMicros = micros();
         current->start();
+        lastTransitionMicros += micros() - startMicros;
+        queueHints();
+    }
+
+    void frameStarted(uint32_t nowMicros) {
+        lastDisplayRefresh = now;
+        uint32_t interval = getFrameMicros();
+        nextFrameMicros += interval;
+        if ( (int32_t)(nowMicros - nextFrameMicros) >= 0 ) {
+            nextFrameMicros = nowMicros + interval; //Too late, don't try to catch up
+        }
+        uint32_t window = nowMicros - fpsWindowStart;
+        if ( window >= 1000000UL ) { //Frames started in the window, so this frame starts the next one
+            achievedFps = (uint16_t)((fpsFrames * 1000000UL + window / 2) / window);
+            fpsFrames = 0;
+            fpsWindowStart = nowMicros;
+        }
+        fpsFrames++;
+    }
+
+    bool isKeepAliveDue() const {
+        return keepAliveMs > 0 && (uint32_t)(now - lastDisplayRefresh) >= keepAliveMs;
+    }
+
+    void drawTransitionFrame() {
+        uint32_t elapsed = now - transitionStart;
+        transitionFrame.progress = elapsed >= transitionFrame.durationMs 
+            ? TransitionFrame::PROGRESS_MAX 
+            : static_cast<uint16_t>((elapsed * TransitionFrame::PROGRESS_MAX) / transitionFrame.durationMs);
+        transitionRenderer->drawTransitionFrame(transitionFrame);
+        if ( transitionFrame.isComplete() ) finishTransition();
+    }
+
+    void finishTransition() {
+        transitioning = false;
+        transitionRenderer->endTransition(transitionFrame);
+        startCurrent();
+    }
+
+    //Queue the screens the routers expect for Next and Back to be prepared
+    void queueHints() {
+        for (uint8_t i = 0; i < PREPARE_QUEUE_SIZE; ++i) {
+            prepareQueue[i] = InvalidScreenHandle;
+        }
+        for (auto router : routers) {
+            prepareScreen(router->hintScreen(currentHandle, TransitionIntentType::Next));
+            prepareScreen(router->hintScreen(currentHandle, TransitionIntentType::Back));
+        }
+        prepareScreen(getBackHandle()); //The default for Back
+    }
+
+    //Prepare one queued screen
+    void prepareNext() {
+        for (uint8_t i = 0; i < PREPARE_QUEUE_SIZE; ++i) {
+            ScreenHandle handle = prepareQueue[i];
+            if ( handle == InvalidScreenHandle ) continue;
+            prepareQueue[i] = InvalidScreenHandle;
+            if ( handle == currentHandle || isPrepared(handle) ) continue;
+            screens[handle]->prepare();
+            setPrepared(handle, true);
+            return;
+        }
+    }
+
+    uint8_t historyIndex(uint8_t depth) const {
+        return static_cast<uint8_t>((historyStart + depth) % SCREEN_MANAGER_HISTORY_SIZE);
+    }
+
+    void pushHistory(ScreenHandle handle, uint16_t state) {
+        if ( historyCount == SCREEN_MANAGER_HISTORY_SIZE ) { //Full, drop the oldest
+            historyStart = historyIndex(1);
+            historyCount--;
+        }
+        history[historyIndex(historyCount)] = handle;
+        historyState[historyIndex(historyCount)] = state;
+        historyCount++;
+    }
+
+    void setPrepared(ScreenHandle handle, bool isPrepared) {
+        if ( handle >= screenCount ) return;
+        if ( isPrepared ) {
+            prepared[handle / 8] |= (1 << (handle % 8));
+        } else {
+            prepared[handle / 8] &= ~(1 << (handle % 8));
+        }
     }
 
 
-    std::unordered_map<std::string, IManagedScreen*> screens;
+    IManagedScreen* screens[SCREEN_MANAGER_MAX_SCREENS] = {}; //Registered screens, indexed by ScreenHandle
+    uint8_t screenCount = 0;
     std::vector<IScreenRouter*> routers;
     IManagedScreen* current = nullptr;
     IManagedScreen* previous = nullptr;
+    ScreenHandle currentHandle = InvalidScreenHandle;
+    ScreenHandle previousHandle = InvalidScreenHandle;
+    static const uint8_t PREPARE_QUEUE_SIZE = 4;
+    ScreenHandle prepareQueue[PREPARE_QUEUE_SIZE] = { InvalidScreenHandle, InvalidScreenHandle, InvalidScreenHandle, InvalidScreenHandle };
+    uint8_t prepared[(SCREEN_MANAGER_MAX_SCREENS + 7) / 8] = {}; //One bit per screen
+    uint32_t lastTransitionMicros = 0;
+    ITransitionRenderer* transitionRenderer = nullptr;
+    TransitionStyle transitionStyle = TransitionStyle::None;
+    uint16_t transitionMs = 250;
+    TransitionFrame transitionFrame;
+    bool transitioning = false;
+    uint32_t transitionStart = 0;
+    ScreenHandle history[SCREEN_MANAGER_HISTORY_SIZE] = {}; //Ring of screens to go Back to
+    uint16_t historyState[SCREEN_MANAGER_HISTORY_SIZE] = {}; //The saveState() of each screen in the history
+    uint8_t historyStart = 0;
+    uint8_t historyCount = 0;
     TransitionIntent pendingIntent;
-    uint16_t displayRefreshMs = 100;
+    uint8_t defaultFps = 10;
+    uint8_t screenFps[SCREEN_MANAGER_MAX_SCREENS] = {}; //0 to use defaultFps
+    uint32_t nextFrameMicros = 0;
+    uint32_t fpsWindowStart = 0;
+    uint16_t fpsFrames = 0;
+    uint16_t achievedFps = 0;
+    uint16_t keepAliveMs = SCREEN_MANAGER_KEEP_ALIVE_MS;
     uint32_t now = millis();
     uint32_t lastDisplayRefresh = 0;
-    std::string initialScreen = ""; //Because C/C++ map->begin() doesn't return first insertion and no 'orderedmap'... \_0_/
 
 };
 
@@ -7,6 +7,7 @@
 #include <Arduino.h>
 
 #include <string>
+#include "ui/BandCanvas.h"
 
 namespace input_events {
 
@@ -50,6 +51,13 @@ class IManagedScreen {
      */
     virtual void begin() = 0;
 
+    /**
+     * @brief Called by `EventScreenManager` during idle frames when this screen is likely to be next (see 
+     * `IScreenRouter::hintScreen()`), so it can precompute layouts, fill icon caches etc and start() is faster.
+     * Not called again until the screen has been started and ended. By default, does nothing.
+     */
+    virtual void prepare() {}
+
     /**
      * @brief Called by `EventScreenManager` when this screen is set active
      */
@@ -60,12 +68,50 @@ class IManagedScreen {
      */
     virtual void draw() = 0;
 
+    /**
+     * @brief Called by `EventScreenManager` before draw(). Return false if nothing has changed so the frame 
+     * (and its SPI traffic) is skipped, eg `return container.isRedrawPending();`. By default, returns true so 
+     * draw() is called every frame.
+     * 
+     * @return true 
+     * @return false 
+     */
+    virtual bool needsDraw() { return true; }
+
     /**
      * @brief Called by `EventScreenManager` before the next screen is set active
      * 
      */
     virtual void end() = 0;
 
+    /**
+     * @brief Called by `EventScreenManager` before end() when this screen is added to the history. The value 
+     * is passed to restoreState() when the screen is returned to with Back. By default, returns 0.
+     * 
+     * @return uint16_t eg a selected item or scroll position
+     */
+    virtual uint16_t saveState() { return 0; }
+
+    /**
+     * @brief Called by `EventScreenManager` before start() when returning to this screen with Back. By default, does nothing.
+     * 
+     * @param state The value returned by saveState()
+     */
+    virtual void restoreState(uint16_t /*state*/) {}
+
+    /**
+     * @brief Called by a band transition renderer (eg `BandTransitionRenderer`) to draw this screen into a band 
+     * of the display during an animated transition. The canvas origin is set to the screen's offset, so draw 
+     * exactly as for the display, eg call `drawBand(canvas)` of each widget. Called for the screen being left 
+     * (after its end()) and the screen being entered (before its start()), once per band of each frame. By 
+     * default, draws nothing and returns false.
+     * 
+     * @param canvas 
+     * @return true If the screen was drawn
+     * @return false If not supported - the screen's area is left filled with the renderer's background colour
+     */
+    virtual bool drawTransitionBand(BandCanvas& /*canvas*/) { return false; }
+
 };
 
 /** @}*/
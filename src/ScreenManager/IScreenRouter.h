@@ -5,7 +5,6 @@
 #if __has_include(<vector>) && __has_include(<string>) //Check if std lib is supported
 
 #include <Arduino.h>
-#include <string>
 #include "ScreenTransition.h"
 
 namespace input_events {
@@ -23,14 +22,28 @@ public:
     virtual ~IScreenRouter() = default;
 
     /**
-     * @brief Resolve a scren transition intent's validity. Can return an empty string (no objection) or a redirect
+     * @brief Resolve a scren transition intent's validity. Can return InvalidScreenHandle (no objection) or a redirect.
      * 
-     * @param current 
+     * @details Get the handles of the screens the router needs with `EventScreenManager::getHandle()` during setup.
+     * 
+     * @param current The handle of the current screen (InvalidScreenHandle on Init)
      * @param intent 
-     * @return std::string 
+     * @return ScreenHandle 
      */
-    virtual std::string resolveScreen(const std::string& current,
+    virtual ScreenHandle resolveScreen(ScreenHandle current,
                                 const TransitionIntent& intent) = 0;
+
+    /**
+     * @brief Return the screen a transition of type from current would probably resolve to, so it can be 
+     * prepared in advance. Called for Next and Back after each transition. By default, no hint.
+     * 
+     * @param current 
+     * @param type 
+     * @return ScreenHandle or InvalidScreenHandle for no hint
+     */
+    virtual ScreenHandle hintScreen(ScreenHandle /*current*/, TransitionIntentType /*type*/) {
+        return InvalidScreenHandle;
+    }
 };
 
 /** @}*/
@@ -0,0 +1,194 @@
+#ifndef INPUT_EVENTS_ITRANSITION_RENDERER_H
+#define INPUT_EVENTS_ITRANSITION_RENDERER_H
+
+#if defined(__has_include)
+#if __has_include(<vector>) && __has_include(<string>) //Check if std lib is supported
+
+#include <Arduino.h>
+#include "ScreenTransition.h"
+
+namespace input_events {
+
+/** \ingroup ScreenManager
+ *  @{
+ */
+
+/**
+ * @brief The visual style of a screen transition
+ * 
+ */
+enum class TransitionStyle : uint8_t {
+    None,       ///< Switch immediately
+    SlideLeft,  ///< The next screen slides in from the right, pushing the current screen out to the left
+    SlideRight, ///< The next screen slides in from the left
+    SlideUp,    ///< The next screen slides in from the bottom
+    SlideDown,  ///< The next screen slides in from the top
+    WipeLeft,   ///< The next screen is revealed from right to left
+    WipeRight,  ///< The next screen is revealed from left to right
+    Fade        ///< The current screen fades out and the next screen fades in
+};
+
+/**
+ * @brief Return the style that reverses style (eg SlideLeft -> SlideRight), used for Back transitions
+ * 
+ * @param style 
+ * @return TransitionStyle 
+ */
+inline TransitionStyle reverseTransition(TransitionStyle style) {
+    switch (style) {
+        case TransitionStyle::SlideLeft : return TransitionStyle::SlideRight;
+        case TransitionStyle::SlideRight : return TransitionStyle::SlideLeft;
+        case TransitionStyle::SlideUp : return TransitionStyle::SlideDown;
+        case TransitionStyle::SlideDown : return TransitionStyle::SlideUp;
+        case TransitionStyle::WipeLeft : return TransitionStyle::WipeRight;
+        case TransitionStyle::WipeRight : return TransitionStyle::WipeLeft;
+        default: return style;
+    }
+}
+
+/**
+ * @brief One frame of a screen transition, with helpers for the geometry of each style
+ * 
+ */
+struct TransitionFrame {
+    static const uint16_t PROGRESS_MAX = 1000; ///< progress at the end of the transition
+
+    TransitionStyle style{TransitionStyle::None}; ///< The style of transition
+    ScreenHandle from{InvalidScreenHandle}; ///< The screen being left
+    ScreenHandle to{InvalidScreenHandle}; ///< The screen being entered
+    uint16_t progress{0}; ///< 0 to PROGRESS_MAX, calculated from the elapsed time (so frames are skipped if drawing is slow)
+    uint16_t durationMs{0}; ///< The duration of the transition
+
+    /**
+     * @brief Scale a size (eg the display width) by progress
+     * 
+     * @param size 
+     * @return uint16_t 
+     */
+    uint16_t scaled(uint16_t size) const {
+        return static_cast<uint16_t>((static_cast<uint32_t>(size) * progress) / PROGRESS_MAX);
+    }
+
+    /**
+     * @brief The x offset of the screen being left, for a Slide
+     * 
+     * @param width The display width
+     * @return int16_t 
+     */
+    int16_t fromX(uint16_t width) const {
+        if ( style == TransitionStyle::SlideLeft ) return static_cast<int16_t>(-scaled(width));
+        if ( style == TransitionStyle::SlideRight ) return static_cast<int16_t>(scaled(width));
+        return 0;
+    }
+
+    /**
+     * @brief The x offset of the screen being entered, for a Slide
+     * 
+     * @param width The display width
+     * @return int16_t 
+     */
+    int16_t toX(uint16_t width) const {
+        if ( style == TransitionStyle::SlideLeft ) return static_cast<int16_t>(width - scaled(width));
+        if ( style == TransitionStyle::SlideRight ) return static_cast<int16_t>(scaled(width) - width);
+        return 0;
+    }
+
+    /**
+     * @brief The y offset of the screen being left, for a Slide
+     * 
+     * @param height The display height
+     * @return int16_t 
+     */
+    int16_t fromY(uint16_t height) const {
+        if ( style == TransitionStyle::SlideUp ) return static_cast<int16_t>(-scaled(height));
+        if ( style == TransitionStyle::SlideDown ) return static_cast<int16_t>(scaled(height));
+        return 0;
+    }
+
+    /**
+     * @brief The y offset of the screen being entered, for a Slide
+     * 
+     * @param height The display height
+     * @return int16_t 
+     */
+    int16_t toY(uint16_t height) const {
+        if ( style == TransitionStyle::SlideUp ) return static_cast<int16_t>(height - scaled(height));
+        if ( style == TransitionStyle::SlideDown ) return static_cast<int16_t>(scaled(height) - height);
+        return 0;
+    }
+
+    /**
+     * @brief The x position of the wipe edge. For WipeLeft the next screen is shown right of the edge, 
+     * for WipeRight to the left of it.
+     * 
+     * @param width The display width
+     * @return uint16_t 
+     */
+    uint16_t wipeX(uint16_t width) const {
+        return style == TransitionStyle::WipeLeft ? static_cast<uint16_t>(width - scaled(width)) : scaled(width);
+    }
+
+    /**
+     * @brief The opacity of the next screen for a Fade, 0 to 255
+     * 
+     * @return uint8_t 
+     */
+    uint8_t alpha() const {
+        return static_cast<uint8_t>(scaled(255));
+    }
+
+    /**
+     * @brief Returns true if this is the last frame
+     * 
+     * @return true 
+     * @return false 
+     */
+    bool isComplete() const { return progress >= PROGRESS_MAX; }
+};
+
+/**
+ * @brief The interface for a class that draws animated screen transitions for EventScreenManager. 
+ * 
+ * @details The renderer owns the display, so it can use whatever the display supports: hardware scrolling 
+ * for slides, a BandRenderer to compose both screens, or fills for a fade through a colour. Each frame should 
+ * be quick, as it is drawn from `EventScreenManager::update()` and touch is sampled between frames. 
+ * `BandTransitionRenderer` draws every style from each screen's `IManagedScreen::drawTransitionBand()`.
+ * 
+ * The next screen's start() is called after endTransition(), so it can draw any remaining elements.
+ * 
+ */
+class ITransitionRenderer {
+public:
+    virtual ~ITransitionRenderer() = default;
+
+    /**
+     * @brief Called when a transition starts, after the current screen's end()
+     * 
+     * @param frame The first frame (progress 0)
+     */
+    virtual void beginTransition(const TransitionFrame& /*frame*/) {}
+
+    /**
+     * @brief Draw a frame of the transition. Called at the EventScreenManager frame rate. Frames that would be 
+     * late are skipped, so progress may jump.
+     * 
+     * @param frame 
+     */
+    virtual void drawTransitionFrame(const TransitionFrame& frame) = 0;
+
+    /**
+     * @brief Called when the transition is complete (or interrupted by another transition), before the next screen's start()
+     * 
+     * @param frame The last frame drawn
+     */
+    virtual void endTransition(const TransitionFrame& /*frame*/) {}
+};
+
+/** @}*/
+
+} // namespace
+
+#endif
+#endif
+
+#endif
@@ -5,7 +5,6 @@
 #if __has_include(<vector>) && __has_include(<string>) //Check if std lib is supported
 
 #include <Arduino.h>
-#include <string>
 
 namespace input_events {
 
@@ -13,6 +12,17 @@ namespace input_events {
  *  @{
  */
 
+/**
+ * @brief The handle of a screen registered with EventScreenManager (its index in the registry). 
+ * Get with `EventScreenManager::getHandle()` during setup and use for transitions and checks without string compares.
+ */
+typedef uint8_t ScreenHandle;
+
+/**
+ * @brief An invalid (or no) ScreenHandle
+ */
+constexpr ScreenHandle InvalidScreenHandle = 0xFF;
+
 /**
  * @brief Types of screen transition
  * 
@@ -21,17 +31,18 @@ enum class TransitionIntentType : uint8_t {
     None, ///< No trnsition, stay on current screen
     Auto, ///< The IScreenRouter decides which screen to transition to.
     Next, ///< The IScreenRouter can accept a provided screen name or redirect
-    Back, ///< The IScreenRouter determines what the previous screen should be
-    Init  ///< Only the first IScreenRouter can resolve this.
+    Back, ///< The IScreenRouter determines what the previous screen should be, otherwise the last screen in the history
+    Init, ///< Only the first IScreenRouter can resolve this.
+    Replace ///< As Next, but the current screen is not added to the history
 };
 
 /**
- * @brief The type of transition and an optional requested screen name
+ * @brief The type of transition and an optional requested screen. A small POD, so it can be copied and reset without allocation.
  * 
  */
 struct TransitionIntent {
     TransitionIntentType type{TransitionIntentType::None}; ///< The type of requested transition
-    std::string requested; ///< optional requested screen id
+    ScreenHandle requested{InvalidScreenHandle}; ///< optional requested screen
 };
 
 /** @}*/
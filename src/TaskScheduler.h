@@ -0,0 +1,292 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+#ifndef INPUT_EVENTS_TASK_SCHEDULER_H
+#define INPUT_EVENTS_TASK_SCHEDULER_H
+
+#ifndef TASK_SCHEDULER_DEFAULT_MAX
+/**
+ * @brief The default maximum number of tasks in a `TaskScheduler` (max 254)
+ */
+#define TASK_SCHEDULER_DEFAULT_MAX 8
+#endif
+
+#include <Arduino.h>
+#include "CallbackDelegate.h"
+#include "YieldPoint.h"
+
+namespace input_events {
+
+/**
+ * @brief A small cooperative scheduler for periodic tasks with priorities, deadlines and overrun reporting.
+ * 
+ * @details Call `run()` from `loop()`. Each due task is run once per `run()`, highest priority first. A task's next 
+ * deadline advances by exactly its period, so it does not drift. If a task starts more than one period late, the 
+ * deadline restarts from now and a missed deadline is counted. If a task takes longer than its budget, an overrun 
+ * is counted.
+ * 
+ * Tasks cannot be interrupted, but after `attachYieldPoint()`, each `yieldPoint()` (eg between widgets in a 
+ * `WidgetContainer::draw()`) runs any due task with a higher priority than the running task and at least the 
+ * yield priority passed to `attachYieldPoint()`. Yield points are part way through a draw(), so only tasks that 
+ * do not draw or change widgets, such as touch sampling, should be at or above the yield priority. Give touch 
+ * sampling that priority so input latency is bounded by the time between yield points, not the time to draw a 
+ * screen, and run anything that handles touch events at the same priority as the screen manager:
+ * ```
+ * TaskScheduler<> scheduler;
+ * 
+ * void setup() {
+ *     touchScreen.enableEventQueue(); //Callbacks are run by processEventQueue(), not at yield points
+ *     scheduler.addTask({&touchScreen, &EventTouchScreen::update}, 5000, 1); //Every 5ms, also at yield points
+ *     scheduler.addTask(processTouchEvents, 10000, 0); //Between frames, never part way through one
+ *     scheduler.addTask({&screenManager, &EventScreenManager::update}, 1000, 0, 20000); //20ms budget
+ *     scheduler.attachYieldPoint(1); //Only priority 1 and above at yield points
+ * }
+ * 
+ * void loop() {
+ *     scheduler.run();
+ * }
+ * ```
+ * 
+ * @tparam maxTasks The maximum number of tasks
+ */
+template<uint8_t maxTasks = TASK_SCHEDULER_DEFAULT_MAX>
+class TaskScheduler {
+
+    public:
+
+    /**
+     * @brief The task function - a function or class method without heap allocation
+     */
+    typedef CallbackDelegate<> TaskFunction;
+
+    static constexpr uint8_t InvalidTask = 0xFF; ///< Returned by addTask() if full
+
+    /**
+     * @brief Add a task. Tasks with the same priority are run in the order they are added.
+     * 
+     * @param task 
+     * @param periodMicros The time between deadlines. 0 to run on every run().
+     * @param priority Higher priority tasks run first, and at the yield points of lower priority tasks if at least 
+     * the yield priority (see `attachYieldPoint()`)
+     * @param budgetMicros An overrun is counted if the task takes longer than this. 0 for no budget.
+     * @return uint8_t The task id or InvalidTask if full
+     */
+    uint8_t addTask(TaskFunction task, uint32_t periodMicros, uint8_t priority = 0, uint32_t budgetMicros = 0) {
+        if ( !task || count >= maxTasks ) return InvalidTask;
+        uint8_t id = count;
+        uint8_t index = count;
+        while ( index > 0 && tasks[order[index - 1]].priority < priority ) { //Shift lower priority tasks down
+            order[index] = order[index - 1];
+            --index;
+        }
+        order[index] = id;
+        Task& t = tasks[id];
+        t.function = task;
+        t.periodMicros = periodMicros;
+        t.budgetMicros = budgetMicros;
+        t.priority = priority;
+        t.deadline = micros();
+        count++;
+        return id;
+    }
+
+    /**
+     * @brief Run each due task once, highest priority first. Call from loop().
+     * 
+     * @return uint8_t The number of tasks run
+     */
+    uint8_t run() {
+        return runAbove(running == InvalidTask ? -1 : tasks[running].priority);
+    }
+
+    /**
+     * @brief Run due tasks with a higher priority than the running task and at least the yield priority. Called by 
+     * yieldPoint() after attachYieldPoint().
+     * 
+     * @return uint8_t The number of tasks run
+     */
+    uint8_t runUrgent() {
+        if ( running == InvalidTask ) return 0; //Not called from a task, wait for run()
+        int16_t above = tasks[running].priority;
+        if ( yieldPriority - 1 > above ) above = yieldPriority - 1;
+        return runAbove(above);
+    }
+
+    /**
+     * @brief Set this scheduler's runUrgent() as the `yieldPoint()` hook
+     * 
+     * @param minPriority Only tasks with at least this priority are run at yield points. The default 1 excludes 
+     * tasks added with the default priority 0.
+     */
+    void attachYieldPoint(uint8_t minPriority = 1) {
+        yieldPriority = minPriority;
+        setYieldHook(YieldHook(this, &TaskScheduler::yieldHookMethod));
+    }
+
+    /**
+     * @brief Enable or disable a task. An enabled task is due immediately.
+     * 
+     * @param id 
+     * @param enable 
+     */
+    void enableTask(uint8_t id, bool enable = true) {
+        if ( id >= count ) return;
+        tasks[id].enabled = enable;
+        tasks[id].deadline = micros();
+    }
+
+    /**
+     * @brief Returns true if the task is enabled
+     * 
+     * @param id 
+     * @return true 
+     * @return false 
+     */
+    bool isTaskEnabled(uint8_t id) const { return id < count && tasks[id].enabled; }
+
+    /**
+     * @brief Change the period of a task. The next deadline is unchanged.
+     * 
+     * @param id 
+     * @param periodMicros 
+     */
+    void setPeriod(uint8_t id, uint32_t periodMicros) {
+        if ( id < count ) tasks[id].periodMicros = periodMicros;
+    }
+
+    /**
+     * @brief The number of times the task took longer than its budget
+     * 
+     * @param id 
+     * @return uint16_t 
+     */
+    uint16_t getOverruns(uint8_t id) const { return id < count ? tasks[id].overruns : 0; }
+
+    /**
+     * @brief The number of times the task started more than one period after its deadline
+     * 
+     * @param id 
+     * @return uint16_t 
+     */
+    uint16_t getMissedDeadlines(uint8_t id) const { return id < count ? tasks[id].missed : 0; }
+
+    /**
+     * @brief The longest time the task has taken in µs (including any urgent tasks run at its yield points)
+     * 
+     * @param id 
+     * @return uint32_t 
+     */
+    uint32_t getMaxMicros(uint8_t id) const { return id < count ? tasks[id].maxMicros : 0; }
+
+    /**
+     * @brief The longest time between a task's deadline and it starting in µs
+     * 
+     * @param id 
+     * @return uint32_t 
+     */
+    uint32_t getMaxLatencyMicros(uint8_t id) const { return id < count ? tasks[id].maxLatency : 0; }
+
+    /**
+     * @brief Reset the overrun, missed deadline, max time and max latency of all tasks
+     * 
+     */
+    void resetStats() {
+        for (uint8_t i = 0; i < count; ++i) {
+            tasks[i].overruns = 0;
+            tasks[i].missed = 0;
+            tasks[i].maxMicros = 0;
+            tasks[i].maxLatency = 0;
+        }
+    }
+
+    /**
+     * @brief The time in µs until the next task is due, 0 if a task is due now. Can be used to sleep in loop().
+     * 
+     * @return uint32_t UINT32_MAX if no tasks are enabled
+     */
+    uint32_t microsToNextTask() const {
+        uint32_t now = micros();
+        uint32_t next = UINT32_MAX;
+        for (uint8_t i = 0; i < count; ++i) {
+            if ( !tasks[i].enabled ) continue;
+            int32_t until = (int32_t)(tasks[i].deadline - now);
+            if ( until <= 0 ) return 0;
+            if ( (uint32_t)until < next ) next = (uint32_t)until;
+        }
+        return next;
+    }
+
+    /**
+     * @brief The id of the running task or InvalidTask
+     * 
+     * @return uint8_t 
+     */
+    uint8_t getRunningTask() const { return running; }
+
+    /**
+     * @brief The number of tasks
+     * 
+     * @return uint8_t 
+     */
+    uint8_t size() const { return count; }
+
+    private:
+
+    struct Task {
+        TaskFunction function;
+        uint32_t periodMicros = 0;
+        uint32_t budgetMicros = 0;
+        uint32_t deadline = 0;
+        uint32_t maxMicros = 0;
+        uint32_t maxLatency = 0;
+        uint16_t overruns = 0;
+        uint16_t missed = 0;
+        uint8_t priority = 0;
+        bool enabled = true;
+    };
+
+    void yieldHookMethod() { runUrgent(); }
+
+    uint8_t runAbove(int16_t minPriority) {
+        uint8_t ran = 0;
+        for (uint8_t i = 0; i < count; ++i) { //In priority order
+            uint8_t id = order[i];
+            Task& t = tasks[id];
+            if ( t.priority <= minPriority ) break;
+            if ( !t.enabled || id == running ) continue;
+            uint32_t start = micros();
+            uint32_t late = start - t.deadline;
+            if ( (int32_t)late < 0 ) continue; //Not due
+            if ( late > t.maxLatency ) t.maxLatency = late;
+            t.deadline += t.periodMicros;
+            if ( (int32_t)(start - t.deadline) >= 0 ) { //More than a period late, don't try to catch up
+                if ( t.periodMicros > 0 && t.missed < 0xFFFF ) t.missed++;
+                t.deadline = start + t.periodMicros;
+            }
+            uint8_t interrupted = running;
+            running = id;
+            t.function();
+            running = interrupted;
+            uint32_t took = micros() - start;
+            if ( took > t.maxMicros ) t.maxMicros = took;
+            if ( t.budgetMicros > 0 && took > t.budgetMicros && t.overruns < 0xFFFF ) t.overruns++;
+            ran++;
+        }
+        return ran;
+    }
+
+    Task tasks[maxTasks];
+    uint8_t order[maxTasks] = {}; //Task ids, highest priority first
+    uint8_t count = 0;
+    uint8_t running = InvalidTask;
+    uint8_t yieldPriority = 1; //The lowest priority run at yield points
+
+};
+
+} //namespace
+#endif
@@ -0,0 +1,173 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+#ifndef INPUT_EVENTS_TOUCH_EVENT_QUEUE_H
+#define INPUT_EVENTS_TOUCH_EVENT_QUEUE_H
+#include <Arduino.h>
+#include "TouchEvent_s.h"
+
+namespace input_events {
+
+/**
+ * @brief A bounded FIFO queue of TouchEvent_s that coalesces consecutive DRAGGED events.
+ * 
+ * @details When a DRAGGED event is pushed and the newest queued event is also DRAGGED, the newest event's
+ * touch point is updated instead of adding a new event. The start and previous touch points of the older
+ * event are retained, so a consumer always sees the latest drag position with the correct drag origin.
+ * 
+ * If the queue is full, room is made by dropping (in order of preference) the oldest DRAGGED event, the oldest 
+ * event that does not start or end a touch (eg IDLE, LONG_PRESS or a click) or the new event if it does not start or
+ * end a touch. PRESSED, RELEASED and DRAGGED_RELEASED are never dropped on their own, so a consumer never sees a 
+ * touch start without its end. Only if the queue is full of them is the oldest complete touch dropped (or, if there
+ * is none, the new touch until it ends). Each dropped event increments `dropped()`.
+ * 
+ * @tparam Capacity Maximum number of queued events (max 255)
+ */
+template<uint8_t Capacity>
+class TouchEventQueue {
+
+    public:
+
+    /**
+     * @brief Add an event to the back of the queue, coalescing with the newest event if both are DRAGGED.
+     * 
+     * @param event 
+     */
+    void push(const TouchEvent_s& event) {
+        if ( skipTouch ) { //The start of this touch was dropped so drop the rest
+            if ( endsTouch(event.type) ) skipTouch = false;
+            countDropped(1);
+            return;
+        }
+        if ( count > 0 && event.type == InputEventType::DRAGGED ) {
+            TouchEvent_s& newest = events[(head + count - 1) % Capacity];
+            if ( newest.type == InputEventType::DRAGGED ) {
+                newest.touchPoint = event.touchPoint;
+                newest.clickCount = event.clickCount;
+                newest.longPressCount = event.longPressCount;
+                return;
+            }
+        }
+        if ( count == Capacity && !makeRoom(event) ) {
+            countDropped(1);
+            return;
+        }
+        events[(head + count) % Capacity] = event;
+        count++;
+    }
+
+    /**
+     * @brief Remove the oldest event from the front of the queue
+     * 
+     * @param event Set to the removed event
+     * @return true An event was removed
+     * @return false The queue is empty
+     */
+    bool pop(TouchEvent_s& event) {
+        if ( count == 0 ) return false;
+        event = events[head];
+        head = (head + 1) % Capacity;
+        count--;
+        return true;
+    }
+
+    /**
+     * @brief Remove all events (does not reset `dropped()`)
+     * 
+     */
+    void clear() {
+        head = 0;
+        count = 0;
+        skipTouch = false;
+    }
+
+    /**
+     * @brief The number of queued events
+     * 
+     * @return uint8_t 
+     */
+    uint8_t size() const { return count; }
+
+    /**
+     * @brief Returns true if no events are queued
+     * 
+     * @return true 
+     * @return false 
+     */
+    bool empty() const { return count == 0; }
+
+    /**
+     * @brief The number of events dropped because the queue was full
+     * 
+     * @return uint16_t 
+     */
+    uint16_t dropped() const { return droppedCount; }
+
+    private:
+
+    static bool startsTouch(InputEventType type) { return type == InputEventType::PRESSED; }
+
+    static bool endsTouch(InputEventType type) {
+        return type == InputEventType::RELEASED || type == InputEventType::DRAGGED_RELEASED;
+    }
+
+    TouchEvent_s& at(uint8_t i) { return events[(head + i) % Capacity]; }
+
+    void countDropped(uint8_t n) {
+        droppedCount = (uint16_t)(droppedCount > 0xFFFF - n ? 0xFFFF : droppedCount + n);
+    }
+
+    //Remove the events from first to last (positions from the oldest)
+    void removeRange(uint8_t first, uint8_t last) {
+        uint8_t n = (uint8_t)(last - first + 1);
+        for ( uint8_t i = first; i + n < count; i++ ) {
+            at(i) = at(i + n);
+        }
+        count = (uint8_t)(count - n);
+        countDropped(n);
+    }
+
+    //Make room for event in a full queue. Returns false if event should be dropped instead.
+    bool makeRoom(const TouchEvent_s& event) {
+        for ( uint8_t i = 0; i < count; i++ ) {
+            if ( at(i).type == InputEventType::DRAGGED ) {
+                removeRange(i, i);
+                return true;
+            }
+        }
+        for ( uint8_t i = 0; i < count; i++ ) {
+            if ( !startsTouch(at(i).type) && !endsTouch(at(i).type) ) {
+                removeRange(i, i);
+                return true;
+            }
+        }
+        if ( !startsTouch(event.type) && !endsTouch(event.type) ) return false;
+        for ( uint8_t i = 0; i < count; i++ ) { //Drop the oldest complete touch
+            if ( !startsTouch(at(i).type) ) continue;
+            for ( uint8_t j = i + 1; j < count; j++ ) {
+                if ( endsTouch(at(j).type) ) {
+                    removeRange(i, j);
+                    return true;
+                }
+            }
+            break;
+        }
+        if ( startsTouch(event.type) ) skipTouch = true;
+        return false;
+    }
+
+    TouchEvent_s events[Capacity];
+    uint8_t head = 0;
+    uint8_t count = 0;
+    uint16_t droppedCount = 0;
+    bool skipTouch = false;
+
+};
+
+} //namespace
+#endif
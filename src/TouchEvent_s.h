@@ -0,0 +1,31 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+#ifndef INPUT_EVENTS_TOUCH_EVENT_S_H
+#define INPUT_EVENTS_TOUCH_EVENT_S_H
+#include <Arduino.h>
+#include "InputEvents.h"
+#include "TouchPoint_s.h"
+
+namespace input_events {
+
+/**
+ * @brief A minimal struct that holds a snapshot of an EventTouchScreen event so it can be queued and dispatched later.
+ * 
+ */
+struct TouchEvent_s {
+    InputEventType type;                ///< The event type
+    TouchPoint_s touchPoint;            ///< The touch point when the event fired
+    TouchPoint_s startTouchPoint;       ///< The start touch point of the touch/drag
+    TouchPoint_s previousTouchPoint;    ///< The touch point of the previous DRAGGED event
+    uint8_t clickCount = 0;             ///< The click count when the event fired
+    uint8_t longPressCount = 0;         ///< The long press count when the event fired
+};
+
+} //namespace
+#endif
@@ -21,16 +21,26 @@
 #include "ui/BaseWidget.h"
 #include "ui/TouchWidgetMixin.h"
 #include "TouchKeypadKey.h"
+#include "TouchKeypadLayout.h"
 
 namespace input_events {
 
 /**
  * @brief A base class for creating touch keypads. This class organises TouchKeypadKey's into a grid format. As with other widgets, drawing is delegated to the concrete class.
  * 
+ * @details With VariableLayout set, keys can span more than one row or column (`setKeySpan()`) and each row can 
+ * have its own number of keys, offset and key width (`setRowLayout()`) for staggered keyboards. This costs 2 bytes 
+ * per key and 5 bytes per row, so is off by default. The key under a touch point is found by division (and a 
+ * lookup table with VariableLayout), so the cost does not increase with the size of the keypad.
+ * 
+ * @tparam NumRows 
+ * @tparam NumCols 
+ * @tparam VariableLayout Set true to use setKeySpan() and setRowLayout()
  */
-template<size_t NumRows, size_t NumCols> 
+template<size_t NumRows, size_t NumCols, bool VariableLayout = false> 
 class BaseTouchKeypadWidget : public BaseWidget, 
-                            public TouchWidgetMixin<BaseTouchKeypadWidget<NumRows, NumCols>> 
+                            public TouchWidgetMixin<BaseTouchKeypadWidget<NumRows, NumCols, VariableLayout>>, 
+                            private TouchKeypadLayout<NumRows, NumCols, VariableLayout> 
                             {
 
     public:
@@ -84,21 +94,68 @@ class BaseTouchKeypadWidget : public BaseWidget,
     }
 
     /**
-     * @brief Called to draw all TouchKeypadKey's
+     * @brief Called to draw all TouchKeypadKey's that require redrawing. Adjacent keys in a row that require 
+     * redrawing are passed to drawKeys() as a run. A key spanning more than one row is passed as a run of its own.
      * 
      */
     void draw() override {
         for ( uint8_t r = 0; r < NumRows; r++ ) {
-            for ( uint8_t c = 0; c < NumCols; c++ ) {
-                if ( !keyRemoved[r][c] && touchKey[r][c].isRedrawRequired() ) {
-                    this->drawKey(touchKey[r][c]);
-                    touchKey[r][c].redrawRequired(false);
+            uint8_t c = 0;
+            while ( c < NumCols ) {
+                if ( !isDirty(r, c) ) {
+                    c++;
+                    continue;
+                }
+                uint8_t first = c;
+                uint8_t last = c;
+                Region runRegion = touchKey[r][c];
+                bool multiRow = isMultiRow(r, c);
+                for ( c = nextKey(r, c); !multiRow && c < NumCols && isDirty(r, c) && !isMultiRow(r, c); c = nextKey(r, c) ) {
+                    last = c;
+                    runRegion = boundingRegion(runRegion, touchKey[r][c]);
+                }
+                this->drawKeys(r, first, last, runRegion);
+                for ( uint8_t k = first; k <= last; k++ ) {
+                    touchKey[r][k].redrawRequired(false);
                 }
             }
         }
         redrawRequired(false);
     }
 
+    /**
+     * @brief Returns true if the keypad or any of its keys requires a redraw
+     * 
+     * @return true 
+     * @return false 
+     */
+    bool isRedrawPending() override {
+        if ( isRedrawRequired() ) return true;
+        for ( uint8_t r = 0; r < NumRows; r++ ) {
+            for ( uint8_t c = 0; c < NumCols; c++ ) {
+                if ( isDirty(r, c) ) return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Called by draw() with a run of adjacent keys in a row that all require redrawing. Override to draw 
+     * the run in one go, eg fill the background of runRegion with one fillRect(), then draw each key's label.
+     * By default, calls drawKey() for each key in the run.
+     * 
+     * @param row 
+     * @param firstCol The first key in the run
+     * @param lastCol The last key in the run. Keys between first and last that are not active (eg covered by a spanning key) are skipped.
+     * @param runRegion The Region covering all keys in the run. This is within the row, unless the run is a single 
+     * key spanning more than one row.
+     */
+    virtual void drawKeys(uint8_t row, uint8_t firstCol, uint8_t lastCol, const Region& /*runRegion*/) {
+        for ( uint8_t c = firstCol; c <= lastCol; c++ ) {
+            if ( isKeyActive(row, c) ) this->drawKey(touchKey[row][c]);
+        }
+    }
+
 
     /**
      * @brief Does nothing
@@ -136,7 +193,8 @@ class BaseTouchKeypadWidget : public BaseWidget,
 
     //For TouchWidgetMixin
     /**
-     * @brief For TouchWidgetMixin, calls each key and sets PRESSED or RELEASED state
+     * @brief For TouchWidgetMixin, the key hit on PRESSED captures the touch and receives all events until RELEASED 
+     * or DRAGGED_RELEASED, when its PRESSED state is reverted. The click events that follow go to the same key.
      * 
      * @param et 
      * @param touchPanel 
@@ -144,28 +202,46 @@ class BaseTouchKeypadWidget : public BaseWidget,
      * @return false 
      */
     bool onTouchEvent(InputEventType et, EventTouchScreen& touchPanel) override {
-        if ( !contains(touchPanel.getStartTouchPoint())) return false; //Not in the keypad region
- 
-        for ( uint8_t r = 0; r < NumRows; r++ ) {
-            for ( uint8_t c = 0; c < NumCols; c++ ) {
-                if ( !keyRemoved[r][c] ) {
-                    if ( et == InputEventType::PRESSED ) {
-                        if ( touchKey[r][c].contains(touchPanel.getStartTouchPoint()) ) {
-                            touchKey[r][c].setState(WidgetDisplayState::PRESSED);
-                        }
-                    } /*else*/ 
-                    if ( et == InputEventType::RELEASED ) {
-                        if ( touchKey[r][c].getState() == WidgetDisplayState::PRESSED) {
-                            touchKey[r][c].setState(touchKey[r][c].getPreviousState()); //Release any key that is pressed
-                        }
-                    }
-                    if ( touchKey[r][c].contains(touchPanel.getStartTouchPoint() ) ) {
-                        return onTouchKeyEvent(touchKey[r][c], et, touchPanel);
+        switch (et) {
+            case InputEventType::PRESSED :
+                capturedKey = nullptr;
+                lastKey = nullptr;
+                if ( !contains(touchPanel.getStartTouchPoint())) return false; //Not in the keypad region
+                capturedKey = keyAt(touchPanel.getStartTouchPoint());
+                if ( capturedKey == nullptr ) return false;
+                lastKey = capturedKey;
+                capturedKey->setState(WidgetDisplayState::PRESSED);
+                return onTouchKeyEvent(*capturedKey, et, touchPanel);
+            case InputEventType::RELEASED :
+            case InputEventType::DRAGGED_RELEASED : {
+                TouchKeypadKey* key = capturedKey;
+                capturedKey = nullptr;
+                if ( key == nullptr ) return false;
+                if ( key->getState() == WidgetDisplayState::PRESSED) {
+                    key->setState(key->getPreviousState()); //Release the captured key
+                }
+                return onTouchKeyEvent(*key, et, touchPanel);
+            }
+            case InputEventType::DRAGGED :
+            case InputEventType::LONG_PRESS :
+                if ( capturedKey == nullptr ) return false;
+                return onTouchKeyEvent(*capturedKey, et, touchPanel);
+            case InputEventType::CLICKED :
+            case InputEventType::DOUBLE_CLICKED :
+            case InputEventType::MULTI_CLICKED :
+            case InputEventType::LONG_CLICKED :
+                if ( lastKey == nullptr ) return false;
+                return onTouchKeyEvent(*lastKey, et, touchPanel);
+            default: { //ENABLED, DISABLED, IDLE etc go to all keys
+                bool handled = false;
+                for ( uint8_t r = 0; r < NumRows; r++ ) {
+                    for ( uint8_t c = 0; c < NumCols; c++ ) {
+                        if ( isKeyActive(r, c) ) handled |= onTouchKeyEvent(touchKey[r][c], et, touchPanel);
                     }
                 }
+                return handled;
             }
         }
-        return false;
     }
 
     /**
@@ -173,11 +249,10 @@ class BaseTouchKeypadWidget : public BaseWidget,
      * 
      * @param row 
      * @param col 
-     * @return TouchKeypadKey* or nullptr if the key has been removed.
+     * @return TouchKeypadKey* or nullptr if the key has been removed or is not active (see `isKeyActive()`).
      */
     TouchKeypadKey* getKey(uint8_t row, uint8_t col ) {
-        if ( row >= NumRows || col >= NumCols ) return nullptr;
-        if ( keyRemoved[row][col] ) return nullptr;
+        if ( !isKeyActive(row, col) ) return nullptr;
         return &touchKey[row][col];
     }
 
@@ -202,23 +277,191 @@ class BaseTouchKeypadWidget : public BaseWidget,
      */
     void removeKey(uint8_t row, uint8_t col, bool remove=true) {
         if ( row >= NumRows || col >= NumCols ) return;
-        keyRemoved[row][col] = remove;
+        uint16_t bit = row * NumCols + col;
+        if ( remove ) {
+            keyRemoved[bit / 8] |= (1 << (bit % 8));
+        } else {
+            keyRemoved[bit / 8] &= ~(1 << (bit % 8));
+        }
+        if ( remove && capturedKey == &touchKey[row][col] ) capturedKey = nullptr;
+        if ( remove && lastKey == &touchKey[row][col] ) lastKey = nullptr;
+    }
+
+    /**
+     * @brief Returns true if the key has been removed (or row or col is out of bounds)
+     * 
+     * @param row 
+     * @param col 
+     * @return true 
+     * @return false 
+     */
+    bool isKeyRemoved(uint8_t row, uint8_t col) const {
+        if ( row >= NumRows || col >= NumCols ) return true;
+        uint16_t bit = row * NumCols + col;
+        return keyRemoved[bit / 8] & (1 << (bit % 8));
+    }
+
+    /**
+     * @brief Set the number of keys in a row and their position, eg for a staggered keyboard. 
+     * Keys at col >= cols are not active.
+     * 
+     * @param row 
+     * @param cols The number of keys in the row (1 to NumCols)
+     * @param offset The x offset of the first key from the left of the keypad
+     * @param keyWidth The width of a single column key. Default 0 is (keypad width - offset) / cols
+     */
+    void setRowLayout(uint8_t row, uint8_t cols, uint16_t offset = 0, uint16_t keyWidth = 0) {
+        static_assert(VariableLayout, "setRowLayout() requires BaseTouchKeypadWidget<NumRows, NumCols, true>");
+        if ( row >= NumRows || cols == 0 || cols > NumCols ) return;
+        layout().setRow(row, cols, offset, keyWidth);
+        rebuildLookup();
+    }
+
+    /**
+     * @brief Make a key span more than one column and/or row, eg for a space bar or tall Enter key. The keys it 
+     * covers are not active (see `isKeyActive()`).
+     * 
+     * @details Column spans are limited to the columns of the key's row. Row spans cover the same columns in the rows 
+     * below, and stop at a row with a different layout (see `setRowLayout()`).
+     * 
+     * @param row 
+     * @param col 
+     * @param rowSpan 1 to 15
+     * @param colSpan 1 to 15
+     */
+    void setKeySpan(uint8_t row, uint8_t col, uint8_t rowSpan, uint8_t colSpan) {
+        static_assert(VariableLayout, "setKeySpan() requires BaseTouchKeypadWidget<NumRows, NumCols, true>");
+        if ( row >= NumRows || col >= NumCols ) return;
+        rowSpan = rowSpan < 1 ? 1 : (rowSpan > 15 ? 15 : rowSpan);
+        colSpan = colSpan < 1 ? 1 : (colSpan > 15 ? 15 : colSpan);
+        layout().setSpan(row, col, static_cast<uint8_t>((rowSpan << 4) | colSpan));
+        rebuildLookup();
+    }
+
+    /**
+     * @brief Returns true if the key is not removed, is within its row's columns and is not covered by a spanning key
+     * 
+     * @param row 
+     * @param col 
+     * @return true 
+     * @return false 
+     */
+    bool isKeyActive(uint8_t row, uint8_t col) const {
+        if ( row >= NumRows || col >= NumCols || isKeyRemoved(row, col) ) return false;
+        return layout().owner(row, col) == row * NumCols + col;
+    }
+
+    /**
+     * @brief Recalculate the key Regions and touch lookup. Called by setRowLayout() and setKeySpan(), call if the 
+     * keypad Region is changed.
+     * 
+     */
+    void rebuildLookup() {
+        for ( uint8_t r = 0; r < NumRows; r++ ) {
+            for ( uint8_t c = 0; c < NumCols; c++ ) {
+                layout().setOwner(r, c, c < layout().cols(r) ? NoKey : OutsideRow);
+            }
+        }
+        for ( uint8_t r = 0; r < NumRows; r++ ) {
+            for ( uint8_t c = 0; c < layout().cols(r); c++ ) {
+                uint8_t key = static_cast<uint8_t>(r * NumCols + c);
+                uint8_t owner = layout().owner(r, c);
+                if ( owner != NoKey && owner != key ) continue; //Covered by an earlier spanning key
+                uint8_t colSpan = layout().span(r, c) & 0x0F;
+                if ( c + colSpan > layout().cols(r) ) colSpan = layout().cols(r) - c;
+                uint8_t rowSpan = 1;
+                while ( rowSpan < (layout().span(r, c) >> 4) && isSameLayout(r, r + rowSpan, c + colSpan) ) rowSpan++;
+                for ( uint8_t sr = r; sr < r + rowSpan; sr++ ) {
+                    for ( uint8_t sc = c; sc < c + colSpan; sc++ ) {
+                        if ( layout().owner(sr, sc) == NoKey ) layout().setOwner(sr, sc, key);
+                    }
+                }
+                touchKey[r][c].setRegion(Region(columnX(r, c), yDiv(NumRows, r), 
+                    static_cast<uint16_t>(columnWidth(r) * colSpan), static_cast<uint16_t>(hDiv(NumRows) * rowSpan)));
+            }
+        }
     }
 
 
     private:
 
+    static_assert(NumRows * NumCols < 254, "BaseTouchKeypadWidget supports up to 253 keys");
+
+    static const uint8_t NoKey = 0xFF;
+    static const uint8_t OutsideRow = 0xFE;
+
+    typedef TouchKeypadLayout<NumRows, NumCols, VariableLayout> Layout;
+
+    Layout& layout() { return *this; }
+    const Layout& layout() const { return *this; }
+
+    uint16_t columnWidth(uint8_t row) const {
+        if ( layout().keyWidth(row) != 0 ) return layout().keyWidth(row);
+        return layout().offset(row) >= w() ? 0 : static_cast<uint16_t>((w() - layout().offset(row)) / layout().cols(row));
+    }
+
+    uint16_t columnX(uint8_t row, uint8_t col) const {
+        return static_cast<uint16_t>(x() + layout().offset(row) + col * columnWidth(row));
+    }
+
+    bool isDirty(uint8_t row, uint8_t col) {
+        return isKeyActive(row, col) && touchKey[row][col].isRedrawRequired();
+    }
+
+    //The column of the next key in the row after a (possibly spanning) key
+    uint8_t nextKey(uint8_t row, uint8_t col) const {
+        return static_cast<uint8_t>(col + (layout().span(row, col) & 0x0F));
+    }
+
+    //A key spanning more than one row is never part of a longer run, so runRegion stays within its row
+    bool isMultiRow(uint8_t row, uint8_t col) const {
+        return (layout().span(row, col) >> 4) > 1;
+    }
+
+    static Region boundingRegion(const Region& a, const Region& b) {
+        uint16_t x = a.x() < b.x() ? a.x() : b.x();
+        uint16_t y = a.y() < b.y() ? a.y() : b.y();
+        uint16_t r = a.r() > b.r() ? a.r() : b.r();
+        uint16_t bottom = a.b() > b.b() ? a.b() : b.b();
+        return Region(x, y, static_cast<uint16_t>(r - x + 1), static_cast<uint16_t>(bottom - y + 1));
+    }
+
+    //A key can only span into rows with the same column positions and enough columns
+    bool isSameLayout(uint8_t row, uint8_t spanRow, uint8_t cols) const {
+        return spanRow < NumRows && layout().cols(spanRow) >= cols 
+            && layout().offset(spanRow) == layout().offset(row) && columnWidth(spanRow) == columnWidth(row);
+    }
+
+    //O(1) - the row is calculated from the touch point, then the column from the row layout and the key from the lookup
+    TouchKeypadKey* keyAt(const Coords_s& coords) {
+        if ( coords.y < y() || hDiv(NumRows) == 0 ) return nullptr;
+        uint16_t r = (coords.y - y()) / hDiv(NumRows);
+        if ( r >= NumRows ) return nullptr;
+        uint16_t left = x() + layout().offset(r);
+        uint16_t width = columnWidth(r);
+        if ( coords.x < left || width == 0 ) return nullptr;
+        uint16_t c = (coords.x - left) / width;
+        if ( c >= layout().cols(r) ) return nullptr;
+        uint8_t key = layout().owner(r, c);
+        if ( key == NoKey || key == OutsideRow ) return nullptr;
+        TouchKeypadKey* found = &touchKey[key / NumCols][key % NumCols];
+        if ( isKeyRemoved(found->row(), found->col()) || !found->contains(coords) ) return nullptr;
+        return found;
+    }
+
     void initKeys() {
         for ( uint8_t r = 0; r < NumRows; r++ ) {
             for ( uint8_t c = 0; c < NumCols; c++ ) {
                 touchKey[r][c] = TouchKeypadKey(xDiv(NumCols, c), yDiv(NumRows, r), wDiv(NumCols), hDiv(NumRows), r, c);
-                keyRemoved[r][c] = false;
             }
         }
+        rebuildLookup();
     }
 
     TouchKeypadKey touchKey[NumRows][NumCols];
-    bool keyRemoved[NumRows][NumCols];
+    uint8_t keyRemoved[(NumRows * NumCols + 7) / 8] = {}; //One bit per key
+    TouchKeypadKey* capturedKey = nullptr; //The key that has captured the current touch
+    TouchKeypadKey* lastKey = nullptr; //The key that captured the last touch
 
 
 };
@@ -0,0 +1,333 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+#ifndef INPUT_EVENTS_COMPACT_TOUCH_KEYPAD_WIDGET_H
+#define INPUT_EVENTS_COMPACT_TOUCH_KEYPAD_WIDGET_H
+
+#include "Arduino.h"
+
+#include "ui/BaseWidget.h"
+#include "ui/TouchWidgetMixin.h"
+
+namespace input_events {
+
+/**
+ * @brief A lightweight reference to a key of a CompactTouchKeypadWidget, passed to drawKey() and onTouchKeyEvent()
+ * 
+ */
+struct KeypadKeyRef {
+    uint8_t row; ///< The row of the key
+    uint8_t col; ///< The column of the key
+    Region region; ///< The Region of the key (calculated from the keypad Region)
+    WidgetDisplayState state; ///< The current state of the key
+    WidgetDisplayState previousState; ///< The previous state of the key
+};
+
+/**
+ * @brief A keypad with the same behaviour as BaseTouchKeypadWidget, but without a TouchKeypadKey (a whole BaseWidget) per key.
+ * 
+ * @details Each key is one byte of packed state (current and previous WidgetDisplayState and a redraw flag) plus 
+ * one bit for removed, and the key Regions are calculated from the keypad Region when needed. A 6 x 10 keypad 
+ * uses 68 bytes for its keys (60 state bytes and 8 bytes of removed bits) instead of 60 TouchKeypadKeys.
+ * 
+ * Keys are identified by row and column. Drawing and touch events are delegated to the concrete class with a KeypadKeyRef.
+ * 
+ */
+template<size_t NumRows, size_t NumCols> 
+class CompactTouchKeypadWidget : public BaseWidget, 
+                            public TouchWidgetMixin<CompactTouchKeypadWidget<NumRows, NumCols>> 
+                            {
+
+    public:
+
+    /**
+     * @brief Construct a CompactTouchKeypadWidget with a Region
+     * 
+     * @param region 
+     */
+    CompactTouchKeypadWidget(Region region) 
+        : BaseWidget(region)
+        {}
+
+    /**
+     * @brief Construct a CompactTouchKeypadWidget with x, y, width and height
+     * 
+     * @param x 
+     * @param y 
+     * @param w 
+     * @param h 
+     */
+    CompactTouchKeypadWidget(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+        : CompactTouchKeypadWidget(Region(x, y, w, h))
+        {}
+
+    /**
+     * @brief Enable all keys
+     * 
+     */
+    void begin() override {
+        for ( uint8_t r = 0; r < NumRows; r++ ) {
+            for ( uint8_t c = 0; c < NumCols; c++ ) {
+                setKeyState(r, c, WidgetDisplayState::ENABLED);
+            }
+        }
+    }
+
+    /**
+     * @brief Called by a screen on start
+     * 
+     */
+    void start() override {
+        for ( uint8_t r = 0; r < NumRows; r++ ) {
+            for ( uint8_t c = 0; c < NumCols; c++ ) {
+                keyState[r][c] |= KEY_REDRAW;
+            }
+        }
+        redrawRequired();
+    }
+
+    /**
+     * @brief Called to draw all keys that require redrawing
+     * 
+     */
+    void draw() override {
+        for ( uint8_t r = 0; r < NumRows; r++ ) {
+            for ( uint8_t c = 0; c < NumCols; c++ ) {
+                if ( !isKeyRemoved(r, c) && (keyState[r][c] & KEY_REDRAW) ) {
+                    this->drawKey(getKey(r, c));
+                    keyState[r][c] &= ~KEY_REDRAW;
+                }
+            }
+        }
+        redrawRequired(false);
+    }
+
+    /**
+     * @brief Does nothing
+     * 
+     */
+    void end() override {
+
+    }
+
+    /**
+     * @brief Does nothing
+     * 
+     */
+    void onStateChanged() override {
+
+    }
+
+    /**
+     * @brief Callback to concrete class to draw a key - this will only be called if the key requires redrawing
+     * 
+     * @param key 
+     */
+    virtual void drawKey(const KeypadKeyRef& key) = 0;
+
+    /**
+     * @brief Abstract method to be implemented by concrete classes
+     * 
+     * @param key 
+     * @param et 
+     * @param touchPanel 
+     * @return true 
+     * @return false 
+     */
+    virtual bool onTouchKeyEvent(const KeypadKeyRef& key, InputEventType et, EventTouchScreen& touchPanel) = 0;
+
+    //For TouchWidgetMixin
+    /**
+     * @brief For TouchWidgetMixin, the key hit on PRESSED captures the touch and receives all events until RELEASED 
+     * or DRAGGED_RELEASED, when its PRESSED state is reverted. The click events that follow go to the same key.
+     * 
+     * @param et 
+     * @param touchPanel 
+     * @return true 
+     * @return false 
+     */
+    bool onTouchEvent(InputEventType et, EventTouchScreen& touchPanel) override {
+        switch (et) {
+            case InputEventType::PRESSED :
+                capturedKey = NoKey;
+                lastKey = NoKey;
+                if ( !contains(touchPanel.getStartTouchPoint())) return false; //Not in the keypad region
+                capturedKey = keyAt(touchPanel.getStartTouchPoint());
+                if ( capturedKey == NoKey ) return false;
+                lastKey = capturedKey;
+                setKeyState(keyRow(capturedKey), keyCol(capturedKey), WidgetDisplayState::PRESSED);
+                return onTouchKeyEvent(getKey(keyRow(capturedKey), keyCol(capturedKey)), et, touchPanel);
+            case InputEventType::RELEASED :
+            case InputEventType::DRAGGED_RELEASED : {
+                uint8_t key = capturedKey;
+                capturedKey = NoKey;
+                if ( key == NoKey ) return false;
+                if ( getKeyState(keyRow(key), keyCol(key)) == WidgetDisplayState::PRESSED ) {
+                    setKeyState(keyRow(key), keyCol(key), getKeyPreviousState(keyRow(key), keyCol(key))); //Release the captured key
+                }
+                return onTouchKeyEvent(getKey(keyRow(key), keyCol(key)), et, touchPanel);
+            }
+            case InputEventType::DRAGGED :
+            case InputEventType::LONG_PRESS :
+                if ( capturedKey == NoKey ) return false;
+                return onTouchKeyEvent(getKey(keyRow(capturedKey), keyCol(capturedKey)), et, touchPanel);
+            case InputEventType::CLICKED :
+            case InputEventType::DOUBLE_CLICKED :
+            case InputEventType::MULTI_CLICKED :
+            case InputEventType::LONG_CLICKED :
+                if ( lastKey == NoKey ) return false;
+                return onTouchKeyEvent(getKey(keyRow(lastKey), keyCol(lastKey)), et, touchPanel);
+            default: { //ENABLED, DISABLED, IDLE etc go to all keys
+                bool handled = false;
+                for ( uint8_t r = 0; r < NumRows; r++ ) {
+                    for ( uint8_t c = 0; c < NumCols; c++ ) {
+                        if ( !isKeyRemoved(r, c) ) handled |= onTouchKeyEvent(getKey(r, c), et, touchPanel);
+                    }
+                }
+                return handled;
+            }
+        }
+    }
+
+    /**
+     * @brief Return a KeypadKeyRef for a row and column (even if it is removed)
+     * 
+     * @param row 
+     * @param col 
+     * @return KeypadKeyRef 
+     */
+    KeypadKeyRef getKey(uint8_t row, uint8_t col) {
+        return KeypadKeyRef{ row, col, getKeyRegion(row, col), getKeyState(row, col), getKeyPreviousState(row, col) };
+    }
+
+    /**
+     * @brief Return the Region of a key (even if it is removed). Will return an empty region if row or col is out of bounds
+     * 
+     * @param row 
+     * @param col 
+     * @return Region 
+     */
+    Region getKeyRegion(uint8_t row, uint8_t col) {
+        if ( row >= NumRows || col >= NumCols ) return Region();
+        return Region(xDiv(NumCols, col), yDiv(NumRows, row), wDiv(NumCols), hDiv(NumRows));
+    }
+
+    /**
+     * @brief Set the state of a key. The key will be redrawn if the state changes.
+     * 
+     * @param row 
+     * @param col 
+     * @param newState 
+     */
+    void setKeyState(uint8_t row, uint8_t col, WidgetDisplayState newState) {
+        if ( row >= NumRows || col >= NumCols ) return;
+        if ( newState == getKeyState(row, col) ) return;
+        uint8_t current = keyState[row][col] & KEY_STATE_MASK;
+        keyState[row][col] = static_cast<uint8_t>(static_cast<uint8_t>(newState) | (current << KEY_PREVIOUS_SHIFT) | KEY_REDRAW);
+        redrawRequired();
+    }
+
+    /**
+     * @brief Get the state of a key
+     * 
+     * @param row 
+     * @param col 
+     * @return WidgetDisplayState 
+     */
+    WidgetDisplayState getKeyState(uint8_t row, uint8_t col) const {
+        if ( row >= NumRows || col >= NumCols ) return WidgetDisplayState::NONE;
+        return static_cast<WidgetDisplayState>(keyState[row][col] & KEY_STATE_MASK);
+    }
+
+    /**
+     * @brief Get the previous state of a key
+     * 
+     * @param row 
+     * @param col 
+     * @return WidgetDisplayState 
+     */
+    WidgetDisplayState getKeyPreviousState(uint8_t row, uint8_t col) const {
+        if ( row >= NumRows || col >= NumCols ) return WidgetDisplayState::NONE;
+        return static_cast<WidgetDisplayState>((keyState[row][col] >> KEY_PREVIOUS_SHIFT) & KEY_STATE_MASK);
+    }
+
+    /**
+     * @brief Mark a key to be redrawn
+     * 
+     * @param row 
+     * @param col 
+     */
+    void keyRedrawRequired(uint8_t row, uint8_t col) {
+        if ( row >= NumRows || col >= NumCols ) return;
+        keyState[row][col] |= KEY_REDRAW;
+        redrawRequired();
+    }
+
+    /**
+     * @brief Mark a key as removed. Removing a key means it will never be passed by drawKey, onTouchKeyEvent etc
+     * 
+     * @param row 
+     * @param col 
+     * @param remove Default true - pass false to 'un-remove'
+     */
+    void removeKey(uint8_t row, uint8_t col, bool remove=true) {
+        if ( row >= NumRows || col >= NumCols ) return;
+        uint16_t bit = row * NumCols + col;
+        if ( remove ) {
+            keyRemoved[bit / 8] |= (1 << (bit % 8));
+            if ( capturedKey == bit ) capturedKey = NoKey;
+            if ( lastKey == bit ) lastKey = NoKey;
+        } else {
+            keyRemoved[bit / 8] &= ~(1 << (bit % 8));
+        }
+    }
+
+    /**
+     * @brief Returns true if the key has been removed (or row or col is out of bounds)
+     * 
+     * @param row 
+     * @param col 
+     * @return true 
+     * @return false 
+     */
+    bool isKeyRemoved(uint8_t row, uint8_t col) const {
+        if ( row >= NumRows || col >= NumCols ) return true;
+        uint16_t bit = row * NumCols + col;
+        return keyRemoved[bit / 8] & (1 << (bit % 8));
+    }
+
+
+    private:
+
+    static_assert(NumRows * NumCols < 255, "CompactTouchKeypadWidget supports up to 254 keys");
+
+    static const uint8_t KEY_STATE_MASK = 0x07; //WidgetDisplayState fits in 3 bits
+    static const uint8_t KEY_PREVIOUS_SHIFT = 3;
+    static const uint8_t KEY_REDRAW = 0x40;
+    static const uint8_t NoKey = 0xFF;
+
+    uint8_t keyRow(uint8_t key) const { return key / NumCols; }
+    uint8_t keyCol(uint8_t key) const { return key % NumCols; }
+
+    //O(1) - the row and column are calculated from the keypad Region
+    uint8_t keyAt(const Coords_s& coords) {
+        if ( coords.x < x() || coords.y < y() || wDiv(NumCols) == 0 || hDiv(NumRows) == 0 ) return NoKey;
+        uint16_t c = (coords.x - x()) / wDiv(NumCols);
+        uint16_t r = (coords.y - y()) / hDiv(NumRows);
+        if ( r >= NumRows || c >= NumCols || isKeyRemoved(r, c) ) return NoKey;
+        return static_cast<uint8_t>(r * NumCols + c);
+    }
+
+    uint8_t keyState[NumRows][NumCols] = {}; //Packed current state, previous state and redraw flag
+    uint8_t keyRemoved[(NumRows * NumCols + 7) / 8] = {}; //One bit per key
+    uint8_t capturedKey = NoKey; //The key that has captured the current touch
+    uint8_t lastKey = NoKey; //The key that captured the last touch
+
+};
+} //namespace
+#endif
@@ -0,0 +1,92 @@
+/**
+ *
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+#ifndef INPUT_EVENTS_TOUCH_KEYPAD_LAYOUT_H
+#define INPUT_EVENTS_TOUCH_KEYPAD_LAYOUT_H
+
+#include "Arduino.h"
+
+namespace input_events {
+
+/**
+ * @brief The spans, row layouts and cell lookup of a `BaseTouchKeypadWidget` with `VariableLayout` set.
+ * Uses 2 bytes per key and 5 bytes per row.
+ * 
+ * @tparam NumRows 
+ * @tparam NumCols 
+ * @tparam VariableLayout 
+ */
+template<size_t NumRows, size_t NumCols, bool VariableLayout>
+class TouchKeypadLayout {
+
+    public:
+
+    uint8_t span(uint8_t row, uint8_t col) const { return keySpan[row][col]; } ///< Row span << 4 | column span
+    void setSpan(uint8_t row, uint8_t col, uint8_t span) { keySpan[row][col] = span; }
+    uint8_t owner(uint8_t row, uint8_t col) const { return cellOwner[row][col]; } ///< The key (row * NumCols + col) that owns a cell
+    void setOwner(uint8_t row, uint8_t col, uint8_t key) { cellOwner[row][col] = key; }
+    uint8_t cols(uint8_t row) const { return rowCols[row]; } ///< The number of keys in a row
+    uint16_t offset(uint8_t row) const { return rowOffset[row]; } ///< The x offset of a row
+    uint16_t keyWidth(uint8_t row) const { return rowKeyWidth[row]; } ///< The column width of a row, 0 is calculated
+
+    void setRow(uint8_t row, uint8_t cols, uint16_t offset, uint16_t keyWidth) {
+        rowCols[row] = cols;
+        rowOffset[row] = offset;
+        rowKeyWidth[row] = keyWidth;
+    }
+
+    protected:
+
+    TouchKeypadLayout() {
+        for ( uint8_t r = 0; r < NumRows; r++ ) {
+            rowCols[r] = NumCols;
+            for ( uint8_t c = 0; c < NumCols; c++ ) {
+                keySpan[r][c] = 0x11;
+            }
+        }
+    }
+
+    private:
+
+    uint8_t keySpan[NumRows][NumCols];
+    uint8_t cellOwner[NumRows][NumCols];
+    uint8_t rowCols[NumRows];
+    uint16_t rowOffset[NumRows] = {};
+    uint16_t rowKeyWidth[NumRows] = {};
+
+};
+
+/**
+ * @brief A fixed grid of single cell keys. Holds nothing, so a keypad without `VariableLayout` pays nothing for
+ * spans and row layouts.
+ * 
+ * @tparam NumRows 
+ * @tparam NumCols 
+ */
+template<size_t NumRows, size_t NumCols>
+class TouchKeypadLayout<NumRows, NumCols, false> {
+
+    public:
+
+    uint8_t span(uint8_t /*row*/, uint8_t /*col*/) const { return 0x11; }
+    void setSpan(uint8_t /*row*/, uint8_t /*col*/, uint8_t /*span*/) {}
+    uint8_t owner(uint8_t row, uint8_t col) const { return static_cast<uint8_t>(row * NumCols + col); }
+    void setOwner(uint8_t /*row*/, uint8_t /*col*/, uint8_t /*key*/) {}
+    uint8_t cols(uint8_t /*row*/) const { return NumCols; }
+    uint16_t offset(uint8_t /*row*/) const { return 0; }
+    uint16_t keyWidth(uint8_t /*row*/) const { return 0; }
+    void setRow(uint8_t /*row*/, uint8_t /*cols*/, uint16_t /*offset*/, uint16_t /*keyWidth*/) {}
+
+    protected:
+
+    TouchKeypadLayout() {}
+
+};
+
+} //namespace
+#endif
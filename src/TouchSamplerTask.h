@@ -0,0 +1,183 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+#ifndef INPUT_EVENTS_TOUCH_SAMPLER_TASK_H
+#define INPUT_EVENTS_TOUCH_SAMPLER_TASK_H
+
+#include <Arduino.h>
+#include "EventTouchScreen.h"
+
+#if defined(TOUCH_SCREEN_THREADED) && TOUCH_SCREEN_EVENT_QUEUE_SIZE > 0
+
+#ifndef TOUCH_SAMPLER_STACK_SIZE
+/**
+ * @brief The stack size of the TouchSamplerTask FreeRTOS task (ESP32 only)
+ */
+#define TOUCH_SAMPLER_STACK_SIZE 4096
+#endif
+
+#include <atomic>
+
+#if defined(ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#define TOUCH_SAMPLER_FREERTOS
+#elif defined(__has_include)
+#if __has_include(<thread>)
+#include <thread>
+#include <chrono>
+#define TOUCH_SAMPLER_STD_THREAD
+#endif
+#endif
+
+#if defined(TOUCH_SAMPLER_FREERTOS) || defined(TOUCH_SAMPLER_STD_THREAD)
+
+namespace input_events {
+
+/**
+ * @brief Runs `EventTouchScreen::update()` on its own task (pinned to a core on ESP32, a `std::thread` elsewhere) 
+ * so touch is sampled at a steady rate however long drawing takes. Requires `TOUCH_SCREEN_THREADED` to be defined
+ * as a build flag.
+ * 
+ * @details Events are published through the lock-free `AtomicTouchEventQueue` and passed to the callback by 
+ * `processEventQueue()`, which is called from loop() (on ESP32 Arduino, loop() runs on core 1, so the default 
+ * core 0 for sampling leaves core 1 for rendering):
+ * ```
+ * TouchSamplerTask sampler(touchScreen);
+ * 
+ * void setup() {
+ *     touchScreen.begin();
+ *     touchScreen.setCallback(onTouchEvent);
+ *     sampler.begin(); //Enables the event queue
+ * }
+ * 
+ * void loop() {
+ *     touchScreen.processEventQueue(); //Callbacks run here, on the render thread
+ *     screenManager.update();
+ * }
+ * ```
+ * 
+ * Thread affinity rules:
+ * - The sampler task only calls `EventTouchScreen::update()`, which reads the touch adapter and pushes to the queue.
+ *   If the touch controller shares a bus (eg SPI) with the display, the adapter must lock the bus.
+ * - The EventTouchScreen callback, and so every widget, screen and `EventScreenManager` call, runs on the thread
+ *   that calls `processEventQueue()`. Within the callback, only use the EventTouchScreen getters (they return the
+ *   queued values). Do not call them outside the callback.
+ * - Configure the EventTouchScreen (setters, `enable()`, `setCallback()`) before `begin()` or after `end()`.
+ * 
+ */
+class TouchSamplerTask {
+
+    public:
+
+    /**
+     * @brief Construct a TouchSamplerTask for touchScreen
+     * 
+     * @param touchScreen 
+     */
+    explicit TouchSamplerTask(EventTouchScreen& touchScreen) : 
+        touchScreen(touchScreen)
+        {}
+
+    /**
+     * @brief Enable the touch screen's event queue and start the sampling task
+     * 
+     * @param periodMs The time between calls to `EventTouchScreen::update()`
+     * @param core The core to run on (ESP32 only)
+     * @param priority The FreeRTOS task priority (ESP32 only)
+     * @return true The task was started
+     * @return false The task is already running or could not be created
+     */
+    bool begin(uint16_t periodMs = 5, uint8_t core = 0, uint8_t priority = 2) {
+        if ( running.load() ) return false;
+        touchScreen.enableEventQueue(); //Before the task starts, so it is visible to it
+        this->periodMs = periodMs > 0 ? periodMs : 1;
+        running.store(true);
+        #if defined(TOUCH_SAMPLER_FREERTOS)
+        stopped.store(false);
+        if ( xTaskCreatePinnedToCore(&TouchSamplerTask::taskMain, "touchSampler", TOUCH_SAMPLER_STACK_SIZE, 
+                                     this, priority, &handle, core) != pdPASS ) {
+            running.store(false);
+            stopped.store(true);
+            return false;
+        }
+        #else
+        (void)core;
+        (void)priority;
+        thread = std::thread(&TouchSamplerTask::sample, this);
+        #endif
+        return true;
+    }
+
+    /**
+     * @brief Stop the sampling task and wait for it to finish. Queued events are kept.
+     * 
+     */
+    void end() {
+        if ( !running.load() ) return;
+        running.store(false);
+        #if defined(TOUCH_SAMPLER_FREERTOS)
+        while ( !stopped.load() ) vTaskDelay(1);
+        handle = nullptr;
+        #else
+        if ( thread.joinable() ) thread.join();
+        #endif
+    }
+
+    /**
+     * @brief Returns true if the sampling task is running
+     * 
+     * @return true 
+     * @return false 
+     */
+    bool isRunning() const { return running.load(); }
+
+    /**
+     * @brief Stops the task
+     * 
+     */
+    ~TouchSamplerTask() { end(); }
+
+    private:
+
+    void sample() {
+        while ( running.load() ) {
+            touchScreen.update();
+            #if defined(TOUCH_SAMPLER_FREERTOS)
+            vTaskDelay(pdMS_TO_TICKS(periodMs) > 0 ? pdMS_TO_TICKS(periodMs) : 1);
+            #else
+            std::this_thread::sleep_for(std::chrono::milliseconds(periodMs));
+            #endif
+        }
+    }
+
+    #if defined(TOUCH_SAMPLER_FREERTOS)
+    static void taskMain(void* param) {
+        TouchSamplerTask* self = static_cast<TouchSamplerTask*>(param);
+        self->sample();
+        self->stopped.store(true);
+        vTaskDelete(nullptr);
+    }
+
+    TaskHandle_t handle = nullptr;
+    std::atomic<bool> stopped{true};
+    #else
+    std::thread thread;
+    #endif
+
+    EventTouchScreen& touchScreen;
+    uint16_t periodMs = 5;
+    std::atomic<bool> running{false};
+
+};
+
+} //namespace
+
+#endif
+#endif
+#endif
@@ -0,0 +1,60 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+#ifndef INPUT_EVENTS_YIELD_POINT_H
+#define INPUT_EVENTS_YIELD_POINT_H
+
+#include <Arduino.h>
+#include "CallbackDelegate.h"
+
+namespace input_events {
+
+/**
+ * @brief The function called at yield points, eg `TaskScheduler::runUrgent()`
+ */
+typedef CallbackDelegate<> YieldHook;
+
+/**
+ * @brief The shared yield hook. Unset by default, so yield points cost a single test.
+ * 
+ * @return YieldHook& 
+ */
+inline YieldHook& yieldHook() {
+    static YieldHook hook;
+    return hook;
+}
+
+/**
+ * @brief Set (or unset with nullptr) the function called at yield points
+ * 
+ * @param hook 
+ */
+inline void setYieldHook(YieldHook hook) {
+    yieldHook() = hook;
+}
+
+/**
+ * @brief Called by long running work (eg `WidgetContainer::draw()` between widgets) where it is safe for urgent 
+ * work such as touch sampling to run. Yield points are not re-entered, so the hook can itself contain yield points.
+ * 
+ * @details The hook must not draw or change widgets - it is called part way through a draw(). With `TaskScheduler`, 
+ * only the touch sampling task should be at or above the priority passed to `attachYieldPoint()`, and 
+ * `EventTouchScreen::enableEventQueue()` should be used so touch callbacks are run later by `processEventQueue()`.
+ * 
+ */
+inline void yieldPoint() {
+    static bool inHook = false;
+    YieldHook& hook = yieldHook();
+    if ( !hook || inHook ) return;
+    inHook = true;
+    hook();
+    inHook = false;
+}
+
+} //namespace
+#endif
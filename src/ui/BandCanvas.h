@@ -0,0 +1,251 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+#ifndef INPUT_EVENTS_BAND_CANVAS_H
+#define INPUT_EVENTS_BAND_CANVAS_H
+
+#include <Arduino.h>
+#include "Region.h"
+#include "CallbackDelegate.h"
+
+namespace input_events {
+
+/**
+ * @brief A function or class method that writes a block of RGB565 pixels to the display, eg with TFT_eSPI's 
+ * <code>pushImage()</code> or Adafruit GFX's <code>drawRGBBitmap()</code>. The pixels are in row order and 
+ * the block is the size of region.
+ */
+typedef CallbackDelegate<const Region&, const uint16_t*> PixelBlockWriter;
+
+/**
+ * @brief A minimal RGB565 canvas over a buffer that represents a Region of the display (eg a horizontal band).
+ * 
+ * @details All drawing methods use absolute display coordinates and are clipped to the canvas clip Region 
+ * (by default the whole canvas Region), so a widget can draw itself exactly as it would to the display.
+ * Method names follow the Adafruit GFX and TFT_eSPI conventions.
+ * 
+ * `setOrigin()` offsets all drawing (but not the clip), eg so a transition renderer can draw a screen part way 
+ * through a slide.
+ * 
+ */
+class BandCanvas {
+
+    public:
+
+    /**
+     * @brief Construct an empty BandCanvas. `begin()` must be called before drawing.
+     * 
+     */
+    BandCanvas() {}
+
+    /**
+     * @brief Construct a BandCanvas over buffer, which must hold at least region.w() * region.h() pixels
+     * 
+     * @param buffer 
+     * @param region 
+     */
+    BandCanvas(uint16_t* buffer, const Region& region) {
+        begin(buffer, region);
+    }
+
+    /**
+     * @brief Set the buffer and Region of the canvas and reset the clip to the whole Region
+     * 
+     * @param buffer Must hold at least region.w() * region.h() pixels
+     * @param region 
+     */
+    void begin(uint16_t* buffer, const Region& region) {
+        pixels = buffer;
+        area.setRegion(region);
+        clip.setRegion(region);
+        clipEmpty = false;
+        originX = 0;
+        originY = 0;
+    }
+
+    /**
+     * @brief The Region of the display the canvas represents
+     * 
+     * @return const Region&
+     */
+    const Region& getRegion() const { return area; }
+
+    /**
+     * @brief The Region drawing is currently clipped to
+     * 
+     * @return const Region&
+     */
+    const Region& getClip() const { return clip; }
+
+    /**
+     * @brief Set the clip Region (limited to the canvas Region)
+     * 
+     * @param region 
+     * @return true If the clip is not empty
+     * @return false If region is outside the canvas - nothing will be drawn
+     */
+    bool setClip(const Region& region) {
+        clipEmpty = !area.intersects(region);
+        if ( !clipEmpty ) clip.setRegion(area.intersection(region));
+        return !clipEmpty;
+    }
+
+    /**
+     * @brief Reset the clip to the whole canvas Region
+     * 
+     */
+    void resetClip() {
+        clip.setRegion(area);
+        clipEmpty = false;
+    }
+
+    /**
+     * @brief Offset all drawing by x, y. The clip is not offset. Reset by begin().
+     * 
+     * @param x 
+     * @param y 
+     */
+    void setOrigin(int16_t x, int16_t y) {
+        originX = x;
+        originY = y;
+    }
+
+    /**
+     * @brief Returns true if any part of region (offset by the origin) would be drawn
+     * 
+     * @param region 
+     * @return true 
+     * @return false 
+     */
+    bool isVisible(const Region& region) const {
+        if ( originX == 0 && originY == 0 ) return !clipEmpty && clip.intersects(region);
+        int32_t x = region.x() + originX;
+        int32_t y = region.y() + originY;
+        return !clipEmpty && region.w() > 0 && region.h() > 0 
+            && x <= clip.r() && x + region.w() > clip.x() && y <= clip.b() && y + region.h() > clip.y();
+    }
+
+    /**
+     * @brief Get the pixel buffer
+     * 
+     * @return uint16_t* 
+     */
+    uint16_t* getBuffer() { return pixels; }
+
+    /**
+     * @brief Fill the clip Region with colour
+     * 
+     * @param colour 
+     */
+    void fill(uint16_t colour) {
+        fillRect(static_cast<int16_t>(clip.x() - originX), static_cast<int16_t>(clip.y() - originY), clip.w(), clip.h(), colour);
+    }
+
+    /**
+     * @brief Draw a single pixel
+     * 
+     */
+    void drawPixel(int16_t x, int16_t y, uint16_t colour) {
+        x += originX;
+        y += originY;
+        if ( clipEmpty || x < clip.x() || x > clip.r() || y < clip.y() || y > clip.b() ) return;
+        pixels[(y - area.y()) * area.w() + (x - area.x())] = colour;
+    }
+
+    /**
+     * @brief Draw a horizontal line
+     * 
+     */
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t colour) {
+        fillRect(x, y, w, 1, colour);
+    }
+
+    /**
+     * @brief Draw a vertical line
+     * 
+     */
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t colour) {
+        fillRect(x, y, 1, h, colour);
+    }
+
+    /**
+     * @brief Draw a rectangle outline
+     * 
+     */
+    void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour) {
+        drawFastHLine(x, y, w, colour);
+        drawFastHLine(x, y + h - 1, w, colour);
+        drawFastVLine(x, y, h, colour);
+        drawFastVLine(x + w - 1, y, h, colour);
+    }
+
+    /**
+     * @brief Draw a filled rectangle
+     * 
+     */
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour) {
+        int16_t x0, y0, x1, y1;
+        if ( !clipRect(static_cast<int16_t>(x + originX), static_cast<int16_t>(y + originY), w, h, x0, y0, x1, y1) ) return;
+        for (int16_t row = y0; row <= y1; ++row) {
+            uint16_t* p = &pixels[(row - area.y()) * area.w() + (x0 - area.x())];
+            for (int16_t col = x0; col <= x1; ++col) {
+                *p++ = colour;
+            }
+        }
+    }
+
+    /**
+     * @brief Draw a filled Region
+     * 
+     * @param region 
+     * @param colour 
+     */
+    void fillRect(const Region& region, uint16_t colour) {
+        fillRect(region.x(), region.y(), region.w(), region.h(), colour);
+    }
+
+    /**
+     * @brief Draw an RGB565 image of w x h pixels with the top left at x, y
+     * 
+     */
+    void pushImage(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* image) {
+        x += originX;
+        y += originY;
+        int16_t x0, y0, x1, y1;
+        if ( !clipRect(x, y, w, h, x0, y0, x1, y1) ) return;
+        for (int16_t row = y0; row <= y1; ++row) {
+            const uint16_t* src = &image[(row - y) * w + (x0 - x)];
+            uint16_t* dst = &pixels[(row - area.y()) * area.w() + (x0 - area.x())];
+            for (int16_t col = x0; col <= x1; ++col) {
+                *dst++ = *src++;
+            }
+        }
+    }
+
+    private:
+
+    bool clipRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t& x0, int16_t& y0, int16_t& x1, int16_t& y1) const {
+        if ( clipEmpty || w <= 0 || h <= 0 ) return false;
+        x0 = x > clip.x() ? x : clip.x();
+        y0 = y > clip.y() ? y : clip.y();
+        x1 = (x + w - 1) < clip.r() ? (x + w - 1) : clip.r();
+        y1 = (y + h - 1) < clip.b() ? (y + h - 1) : clip.b();
+        return x0 <= x1 && y0 <= y1;
+    }
+
+    uint16_t* pixels = nullptr;
+    Region area;
+    Region clip;
+    bool clipEmpty = false;
+    int16_t originX = 0;
+    int16_t originY = 0;
+
+};
+
+} //namespace
+#endif
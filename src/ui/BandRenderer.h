@@ -0,0 +1,162 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+#ifndef INPUT_EVENTS_BAND_RENDERER_H
+#define INPUT_EVENTS_BAND_RENDERER_H
+
+#ifndef BAND_RENDERER_DEFAULT_MAX
+/**
+ * @brief The default maximum number of `IBandDrawable`s in a `BandRenderer`
+ */
+#define BAND_RENDERER_DEFAULT_MAX 10
+#endif
+
+#include <Arduino.h>
+#include "Region.h"
+#include "BandCanvas.h"
+#include "IBandDrawable.h"
+#include "ClipStack.h"
+
+namespace input_events {
+
+/**
+ * @brief Renders widgets (or anything implementing IBandDrawable) off-screen, one horizontal band at a time, into 
+ * a small RGB565 buffer and writes each band to the display as a single block.
+ * 
+ * @details Overlapping widgets are composed in the buffer, so there is no flicker and each pixel is only written 
+ * to the display once per render. Each band is filled with the background colour, then every drawable that 
+ * intersects the band draws into it (in the order added), then the band is passed to the PixelBlockWriter. Each band 
+ * and drawable Region is pushed onto the `clipStack()`, and the canvas is clipped to the result, so a drawable 
+ * cannot draw outside its own Region and icons outside the band are skipped.
+ * 
+ * The band height is BufferPixels / width of the rendered area, eg `BandRenderer<320 * 16>` renders a 320 pixel 
+ * wide screen in bands of 16 lines using 10KB of RAM.
+ * 
+ * The PixelBlockWriter must have finished reading the buffer before it returns. Pixels are RGB565 in native byte 
+ * order, swap bytes in the writer if the display requires it (eg TFT_eSPI <code>setSwapBytes(true)</code>).
+ * 
+ * @tparam BufferPixels The size of the band buffer in pixels
+ * @tparam maxDrawables The maximum number of drawables
+ */
+template<size_t BufferPixels, size_t maxDrawables = BAND_RENDERER_DEFAULT_MAX>
+class BandRenderer {
+
+    public:
+
+    static constexpr size_t InvalidIndex = static_cast<size_t>(-1); ///< Define invalid value as max size
+
+    /**
+     * @brief Construct a BandRenderer
+     * 
+     * @param writer The function or method that writes a block of pixels to the display
+     */
+    explicit BandRenderer(PixelBlockWriter writer) : 
+        writer(writer)
+        {}
+
+    /**
+     * @brief Add a drawable. Drawables are drawn in the order they are added.
+     * 
+     * @param drawable 
+     * @return size_t The index or InvalidIndex if full
+     */
+    size_t addDrawable(IBandDrawable* drawable) {
+        if ( drawable == nullptr || count >= maxDrawables ) return InvalidIndex;
+        drawables[count] = drawable;
+        return count++;
+    }
+
+    /**
+     * @brief Remove a drawable
+     * 
+     * @param drawable 
+     */
+    void removeDrawable(IBandDrawable* drawable) {
+        for (size_t i = 0; i < count; ++i) {
+            if ( drawables[i] == drawable ) {
+                for (size_t j = i; j < count - 1; ++j) {
+                    drawables[j] = drawables[j + 1];
+                }
+                drawables[--count] = nullptr;
+                return;
+            }
+        }
+    }
+
+    /**
+     * @brief Remove all drawables
+     * 
+     */
+    void removeAllDrawables() {
+        for (size_t i = 0; i < count; ++i) {
+            drawables[i] = nullptr;
+        }
+        count = 0;
+    }
+
+    /**
+     * @brief Set the colour each band is filled with before drawing
+     * 
+     * @param colour 
+     */
+    void setBgColour(uint16_t colour) { bgColour = colour; }
+
+    /**
+     * @brief Return the number of lines in a band for an area of width
+     * 
+     * @param width 
+     * @return uint16_t 
+     */
+    static constexpr uint16_t bandLines(uint16_t width) { 
+        return static_cast<uint16_t>(width == 0 ? 0 : BufferPixels / width); 
+    }
+
+    /**
+     * @brief Render area of the display, band by band
+     * 
+     * @param area Usually the whole screen or the Region of a dirty widget
+     * @return true 
+     * @return false If the buffer cannot hold a single line of area
+     */
+    bool render(const Region& area) {
+        uint16_t lines = bandLines(area.w());
+        if ( lines == 0 ) return false;
+        for (uint32_t y = area.y(); y <= area.b(); y += lines) {
+            uint16_t h = static_cast<uint16_t>((area.b() - y + 1) < lines ? (area.b() - y + 1) : lines);
+            Region band(area.x(), static_cast<uint16_t>(y), area.w(), h);
+            canvas.begin(buffer, band);
+            canvas.fill(bgColour);
+            ClipScope bandClip(band);
+            for (size_t i = 0; i < count; ++i) {
+                if ( !drawables[i]->isBandVisible() ) continue;
+                ClipScope clip(drawables[i]->getDrawRegion());
+                if ( clip.isVisible() && canvas.setClip(clipStack().current()) ) {
+                    drawables[i]->drawBand(canvas);
+                }
+            }
+            if ( writer ) writer(band, buffer);
+        }
+        return true;
+    }
+
+    protected:
+
+    IBandDrawable* drawables[maxDrawables] = {}; ///< The drawables
+    size_t count = 0; ///< Number of added drawables
+
+    private:
+
+    PixelBlockWriter writer;
+    BandCanvas canvas;
+    uint16_t bgColour = 0x0000;
+    uint16_t buffer[BufferPixels];
+
+};
+
+} //namespace
+#endif
@@ -0,0 +1,54 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+#ifndef INPUT_EVENTS_BAND_WIDGET_MIXIN_H
+#define INPUT_EVENTS_BAND_WIDGET_MIXIN_H
+
+#include "IBandDrawable.h"
+
+namespace input_events {
+
+/**
+ * @brief A mixin class for BaseWidget that can be drawn by a BandRenderer. The derived widget must implement `drawBand()`.
+ * 
+ */
+template <typename Derived>
+class BandWidgetMixin : public IBandDrawable {
+
+    public:
+
+    /**
+     * @brief The Region of the derived widget
+     * 
+     * @return Region 
+     */
+    Region getDrawRegion() override {
+        return Region(*static_cast<Derived*>(this));
+    }
+
+    /**
+     * @brief False if the derived widget is hidden
+     * 
+     * @return true 
+     * @return false 
+     */
+    bool isBandVisible() override {
+        return !static_cast<Derived*>(this)->isHidden();
+    }
+
+    protected:
+    /**
+     * @brief Protected default constructor to help prevent creation outside of a base derived widget
+     * 
+     */
+    BandWidgetMixin() {} 
+
+};
+
+}
+#endif
@@ -4,9 +4,13 @@
 #include <Arduino.h>
 #include <TFT_eSPI.h>
 #include "Region.h"
+#include "ClipStack.h"
+#include "DisabledGrey.h"
+#include "FixedTrig.h"
 
 namespace input_events {
 
+class BandCanvas;
 
 /**
  * @brief Parameters that can be passed to an icon to alter its drawn state.
@@ -31,9 +35,32 @@ struct IconParams {
      * @param radius 
      * @param pad 
      */
-    IconParams(uint16_t fg=0xFFFF, uint16_t bg=0x0000,
+    constexpr IconParams(uint16_t fg=0xFFFF, uint16_t bg=0x0000,
                bool enabled=true, float scale=1.0f, uint16_t radius=0, float pad=0)
-        : fg(fg), bg(bg), enabled(enabled), scale(scale), radius(radius), pad(pad) {}
+        : fg(fg), bg(bg), alt(0), enabled(enabled), scale(scale), radius(radius), pad(pad) {}
+
+    /**
+     * @brief equality operator
+     * 
+     * @param other 
+     * @return true 
+     * @return false 
+     */
+    constexpr bool operator==(const IconParams& other) const {
+        return fg == other.fg && bg == other.bg && alt == other.alt && enabled == other.enabled
+            && scale == other.scale && radius == other.radius && pad == other.pad;
+    }
+
+    /**
+     * @brief inequality operator
+     * 
+     * @param other 
+     * @return true 
+     * @return false 
+     */
+    constexpr bool operator!=(const IconParams& other) const {
+        return !(*this == other);
+    }
 
     /**
      * @brief Returns a copy of params with passed enabled flag
@@ -108,31 +135,13 @@ struct IconParams {
     }
 
     /**
-     * @brief Convert a colour to greyscale
+     * @brief Convert a colour to greyscale (a table lookup, see DisabledGrey.h)
      * 
      * @param color 
      * @return uint16_t 
      */
-    uint16_t disabledGrey(uint16_t color) {
-        // Extract RGB components
-        uint8_t r5 = (color >> 11) & 0x1F;
-        uint8_t g6 = (color >> 5) & 0x3F;
-        uint8_t b5 =  color        & 0x1F;
-
-        // Convert to 8-bit
-        uint8_t r = (r5 * 527 + 23) >> 6;
-        uint8_t g = (g6 * 259 + 33) >> 6;
-        uint8_t b = (b5 * 527 + 23) >> 6;
-
-        // Weighted luma
-        uint8_t grey = (77 * r + 150 * g + 29 * b) >> 8;
-
-        // Remap from 0–255 to 64–192
-        grey = (grey >> 1) + 64; // Equivalent to (gray * 0.5) + 64
-        //grey = 128 + (grey - 128) * 90 / 100; // white a bit darker, black a bit lighter
-        grey = 128 + (grey - 128) * 70 / 120; // white a bit darker, black a bit lighter
-        // Back to 5/6/5
-        return ((grey >> 3) << 11) | ((grey >> 2) << 5) | (grey >> 3);
+    uint16_t disabledGrey(uint16_t color) const {
+        return disabledGreyLut(color);
     }
 
 // uint16_t disabledGrey2(uint16_t color) {
@@ -191,16 +200,28 @@ class  BaseIcon {
 
 public:
     /**
-     * @brief 
+     * @brief Draw the icon. Nothing is drawn if region is outside the current `clipStack()` clip.
      * 
      * @param region A copy of the Region (my be modified by the params.pad )
      * @param params The parameters to be used to draw this icon
      */
     void draw(Region region, IconParams params ) const {
+        prepare(region, params);
+        if ( !clipStack().isVisible(region) ) return; //Nothing to draw within the clip
+        drawIcon(region, params);
+    }
+
+    /**
+     * @brief Apply params to region and params as draw() does before calling drawIcon(): greyscale if disabled, 
+     * pad the region and set the default radius.
+     * 
+     * @param region 
+     * @param params 
+     */
+    void prepare(Region& region, IconParams& params) const {
         if ( !params.enabled ) params.toGreyscale();
         if ( params.pad != 0 ) region.pad(params.pad);
         if ( params.radius == 0 ) params.radius = static_cast<uint16_t>(min(region.h(), region.w())/2);
-        drawIcon(region, params);
     }
 
     /**
@@ -211,6 +232,30 @@ public:
      */
     virtual void drawIcon(Region region, IconParams params ) const = 0;
 
+    /**
+     * @brief Returns true if the icon implements `drawIconCanvas()`. Icons that do must also override this, so 
+     * an `IconCache` does not evict bitmaps to make room for an icon it cannot rasterise.
+     * 
+     * @return true 
+     * @return false The default
+     */
+    virtual bool isCacheable() const { return false; }
+
+    /**
+     * @brief Optionally implemented in concrete classes to draw the icon to a canvas instead of the display, 
+     * which allows the icon to be cached by an `IconCache` (also override `isCacheable()`). Called with a 
+     * prepared region and params.
+     * 
+     * @param canvas The canvas covers region and is filled with params.bg
+     * @param region 
+     * @param params 
+     * @return true If the icon was drawn to the canvas
+     * @return false If not supported (the default)
+     */
+    virtual bool drawIconCanvas(BandCanvas& /*canvas*/, Region /*region*/, IconParams /*params*/ ) const {
+        return false;
+    }
+
     virtual ~BaseIcon() {}
 
 protected:
@@ -225,6 +270,48 @@ protected:
         return (a * DEG_TO_RAD);
     }
 
+    /**
+     * @brief Sine of whole degrees in Q15 fixed point (32767 = 1.0). Much faster than sin(degree2radian2()) on 
+     * MCUs without a double precision FPU.
+     * 
+     * @param degrees 
+     * @return int16_t 
+     */
+    int16_t sinQ15(int16_t degrees) const { return input_events::sinQ15(degrees); }
+
+    /**
+     * @brief Cosine of whole degrees in Q15 fixed point (32767 = 1.0)
+     * 
+     * @param degrees 
+     * @return int16_t 
+     */
+    int16_t cosQ15(int16_t degrees) const { return input_events::cosQ15(degrees); }
+
+    /**
+     * @brief Return the point on a circle of radius around centre. 0 degrees is 3 o'clock, clockwise.
+     * 
+     * @param centre 
+     * @param radius 
+     * @param degrees 
+     * @return Coords_s 
+     */
+    Coords_s pointOnArc(const Coords_s& centre, int16_t radius, int16_t degrees) const { 
+        return input_events::pointOnArc(centre, radius, degrees); 
+    }
+
+    /**
+     * @brief Fill points with the vertices of a regular polygon around centre
+     * 
+     * @param centre 
+     * @param radius 
+     * @param sides 
+     * @param startDegrees The angle of the first vertex
+     * @param points Must hold at least sides Coords_s
+     */
+    void polygonPoints(const Coords_s& centre, int16_t radius, uint8_t sides, int16_t startDegrees, Coords_s* points) const { 
+        input_events::polygonPoints(centre, radius, sides, startDegrees, points); 
+    }
+
     /**
      * @brief Return only an even number - useful for diameter to radius etc.
      * 
@@ -138,6 +138,13 @@ class BaseWidget : public Region {
      */
     virtual void redrawRequired(bool redraw=true) { requiresRedraw = redraw;}
 
+    /**
+     * @brief Called when `Theme` styles change. Widgets using a style should call redrawRequired() if its bit is set.
+     * 
+     * @param changedStyles A bit for each changed style index (as returned by `Theme::loadTable()`)
+     */
+    virtual void onThemeChanged(uint32_t /*changedStyles*/) {}
+
     /**
      * @brief Returns true if the `redrawRequired()` has been set to `true`
      * 
@@ -146,6 +153,25 @@ class BaseWidget : public Region {
      */
     bool isRedrawRequired() { return requiresRedraw; }
 
+    /**
+     * @brief Returns true if the next draw() will draw anything. By default, the same as isRedrawRequired() but 
+     * widgets with children (containers, keypads) also check them. Used by screens to implement 
+     * `IManagedScreen::needsDraw()`.
+     * 
+     * @return true 
+     * @return false 
+     */
+    virtual bool isRedrawPending() { return isRedrawRequired(); }
+
+    /**
+     * @brief Returns true if everything the widget draws lies within its Region, so a container can clip the 
+     * widget to it. Containers return false if any child lies outside their Region (or they have no size).
+     * 
+     * @return true 
+     * @return false 
+     */
+    virtual bool isClippedToRegion() { return true; }
+
     /**
      * @brief Set the state of the widget. If the derived widget has custom states, create
      * an overloaded `setState(CustomStateEnum)`
@@ -0,0 +1,173 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+#ifndef INPUT_EVENTS_CLIP_STACK_H
+#define INPUT_EVENTS_CLIP_STACK_H
+
+#ifndef CLIP_STACK_DEPTH
+/**
+ * @brief The maximum depth of the clip stack. Deeper pushes are counted but do not narrow the clip.
+ */
+#define CLIP_STACK_DEPTH 8
+#endif
+
+#include <Arduino.h>
+#include "Region.h"
+
+namespace input_events {
+
+/**
+ * @brief A stack of clip Regions. Each push is intersected with the current clip, so the top of the stack is 
+ * always the area that may be drawn to.
+ * 
+ * @details Containers push the Region of each child around its `draw()`, so widgets and icons can use 
+ * `isVisible()` to skip drawing anything that lies entirely outside the clip. When the stack is empty, the clip 
+ * is unbounded and everything is visible.
+ * 
+ * Use `clipStack()` for the shared stack and `ClipScope` to push and pop.
+ * 
+ */
+class ClipStack {
+
+    public:
+
+    /**
+     * @brief Push region, intersected with the current clip
+     * 
+     * @param region 
+     * @return true If the new clip is not empty
+     * @return false If nothing can be drawn
+     */
+    bool push(const Region& region) {
+        if ( depth >= CLIP_STACK_DEPTH ) { //Too deep, keep the current clip
+            overflow++;
+            return !isEmpty();
+        }
+        bool empty = isEmpty() || region.w() == 0 || region.h() == 0 || !current().intersects(region);
+        clips[depth].setRegion(empty ? Region() : current().intersection(region));
+        emptyClip[depth] = empty;
+        depth++;
+        return !empty;
+    }
+
+    /**
+     * @brief Pop the last pushed clip
+     * 
+     */
+    void pop() {
+        if ( overflow > 0 ) {
+            overflow--;
+        } else if ( depth > 0 ) {
+            depth--;
+        }
+    }
+
+    /**
+     * @brief The current clip Region
+     * 
+     * @return Region 
+     */
+    Region current() const {
+        return depth == 0 ? Region(0, 0, 0xFFFF, 0xFFFF) : clips[depth - 1];
+    }
+
+    /**
+     * @brief Returns true if the current clip is empty (ie nothing can be drawn)
+     * 
+     * @return true 
+     * @return false 
+     */
+    bool isEmpty() const {
+        return depth > 0 && emptyClip[depth - 1];
+    }
+
+    /**
+     * @brief Returns true if any part of region is within the current clip
+     * 
+     * @param region 
+     * @return true 
+     * @return false 
+     */
+    bool isVisible(const Region& region) const {
+        return !isEmpty() && current().intersects(region);
+    }
+
+    /**
+     * @brief Return the number of pushed clips
+     * 
+     * @return uint8_t 
+     */
+    uint8_t size() const { return depth + overflow; }
+
+    private:
+
+    Region clips[CLIP_STACK_DEPTH];
+    bool emptyClip[CLIP_STACK_DEPTH] = {};
+    uint8_t depth = 0;
+    uint8_t overflow = 0;
+
+};
+
+/**
+ * @brief The shared ClipStack used by containers, widgets and icons
+ * 
+ * @return ClipStack& 
+ */
+inline ClipStack& clipStack() {
+    static ClipStack stack;
+    return stack;
+}
+
+/**
+ * @brief Push a clip Region for the lifetime of the ClipScope
+ * 
+ * ```
+ * {
+ *     ClipScope clip(*widget);
+ *     if ( clip.isVisible() ) widget->draw();
+ * } //Popped here
+ * ```
+ * 
+ */
+class ClipScope {
+
+    public:
+
+    /**
+     * @brief Push region onto stack
+     * 
+     * @param region 
+     * @param stack Defaults to `clipStack()`
+     */
+    explicit ClipScope(const Region& region, ClipStack& stack = clipStack()) : 
+        stack(stack),
+        visible(stack.push(region))
+        {}
+
+    ~ClipScope() { stack.pop(); }
+
+    /**
+     * @brief Returns true if the pushed clip is not empty
+     * 
+     * @return true 
+     * @return false 
+     */
+    bool isVisible() const { return visible; }
+
+    ClipScope(const ClipScope&) = delete;
+    ClipScope& operator=(const ClipScope&) = delete;
+
+    private:
+
+    ClipStack& stack;
+    bool visible;
+
+};
+
+} //namespace
+#endif
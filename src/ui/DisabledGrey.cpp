@@ -0,0 +1,69 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+#include "DisabledGrey.h"
+
+namespace input_events {
+
+// Generated from disabledGreyReference()
+
+const uint16_t disabledGreyLuma[128] PROGMEM = {
+    0x0000, 0x0268, 0x04D0, 0x0785, 0x09ED, 0x0C55, 0x0EBD, 0x1172,
+    0x13DA, 0x1642, 0x18AA, 0x1B12, 0x1DC7, 0x202F, 0x2297, 0x24FF,
+    0x27B4, 0x2A1C, 0x2C84, 0x2EEC, 0x31A1, 0x3409, 0x3671, 0x38D9,
+    0x3B41, 0x3DF6, 0x405E, 0x42C6, 0x452E, 0x47E3, 0x4A4B, 0x4CB3,
+    0x0000, 0x0258, 0x04B0, 0x0708, 0x0960, 0x0BB8, 0x0E10, 0x1068,
+    0x12C0, 0x1518, 0x1770, 0x1A5E, 0x1CB6, 0x1F0E, 0x2166, 0x23BE,
+    0x2616, 0x286E, 0x2AC6, 0x2D1E, 0x2F76, 0x31CE, 0x3426, 0x367E,
+    0x38D6, 0x3B2E, 0x3D86, 0x3FDE, 0x4236, 0x448E, 0x46E6, 0x493E,
+    0x4C2C, 0x4E84, 0x50DC, 0x5334, 0x558C, 0x57E4, 0x5A3C, 0x5C94,
+    0x5EEC, 0x6144, 0x639C, 0x65F4, 0x684C, 0x6AA4, 0x6CFC, 0x6F54,
+    0x71AC, 0x7404, 0x765C, 0x78B4, 0x7B0C, 0x7DFA, 0x8052, 0x82AA,
+    0x8502, 0x875A, 0x89B2, 0x8C0A, 0x8E62, 0x90BA, 0x9312, 0x956A,
+    0x0000, 0x00E8, 0x01D0, 0x02D5, 0x03BD, 0x04A5, 0x058D, 0x0692,
+    0x077A, 0x0862, 0x094A, 0x0A32, 0x0B37, 0x0C1F, 0x0D07, 0x0DEF,
+    0x0EF4, 0x0FDC, 0x10C4, 0x11AC, 0x12B1, 0x1399, 0x1481, 0x1569,
+    0x1651, 0x1756, 0x183E, 0x1926, 0x1A0E, 0x1B13, 0x1BFB, 0x1CE3
+};
+
+const uint16_t disabledGreyRemap[256] PROGMEM = {
+    0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB,
+    0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB,
+    0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C,
+    0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x632C, 0x632C,
+    0x632C, 0x632C, 0x632C, 0x632C, 0x632C, 0x632C, 0x632C, 0x632C,
+    0x632C, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D,
+    0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D,
+    0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D,
+    0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E,
+    0x738E, 0x738E, 0x738E, 0x738E, 0x738E, 0x738E, 0x738E, 0x738E,
+    0x738E, 0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE, 0x73AE,
+    0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x73AE,
+    0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,
+    0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,
+    0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF,
+    0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410, 0x8410,
+    0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410,
+    0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430,
+    0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430,
+    0x8430, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C51,
+    0x8C51, 0x8C51, 0x8C51, 0x8C51, 0x8C51, 0x8C51, 0x8C51, 0x8C51,
+    0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x8C71, 0x8C71, 0x8C71, 0x8C71,
+    0x8C71, 0x8C71, 0x8C71, 0x8C71, 0x8C71, 0x8C71, 0x8C71, 0x8C71,
+    0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492,
+    0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x94B2, 0x94B2,
+    0x94B2, 0x94B2, 0x94B2, 0x94B2, 0x94B2, 0x94B2, 0x94B2, 0x94B2,
+    0x94B2, 0x94B2, 0x94B2, 0x94B2, 0x9CD3, 0x9CD3, 0x9CD3, 0x9CD3,
+    0x9CD3, 0x9CD3, 0x9CD3, 0x9CD3, 0x9CD3, 0x9CD3, 0x9CD3, 0x9CD3,
+    0x9CF3, 0x9CF3, 0x9CF3, 0x9CF3, 0x9CF3, 0x9CF3, 0x9CF3, 0x9CF3,
+    0x9CF3, 0x9CF3, 0x9CF3, 0x9CF3, 0x9CF3, 0x9CF3, 0xA514, 0xA514,
+    0xA514, 0xA514, 0xA514, 0xA514, 0xA514, 0xA514, 0xA514, 0xA514,
+    0xA514, 0xA514, 0xA514, 0xA514, 0xA534, 0xA534, 0xA534, 0xA534
+};
+
+} //namespace
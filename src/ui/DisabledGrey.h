@@ -0,0 +1,96 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+#ifndef INPUT_EVENTS_DISABLED_GREY_H
+#define INPUT_EVENTS_DISABLED_GREY_H
+
+#include <Arduino.h>
+
+#ifndef pgm_read_word
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#endif
+
+namespace input_events {
+
+/**
+ * @brief The weighted luma contribution of each RGB565 channel, scaled by 256. 
+ * Indexed by red (0-31), 32 + green (0-63) and 96 + blue (0-31). In DisabledGrey.cpp.
+ */
+extern const uint16_t disabledGreyLuma[128] PROGMEM;
+
+/**
+ * @brief The disabled RGB565 grey for each 8 bit luma value. In DisabledGrey.cpp.
+ */
+extern const uint16_t disabledGreyRemap[256] PROGMEM;
+
+/**
+ * @brief Convert an RGB565 colour to the disabled grey by calculation. This is the reference used to generate 
+ * the lookup tables - use `disabledGreyLut()`.
+ * 
+ * @param color 
+ * @return uint16_t 
+ */
+inline uint16_t disabledGreyReference(uint16_t color) {
+    // Extract RGB components
+    uint8_t r5 = (color >> 11) & 0x1F;
+    uint8_t g6 = (color >> 5) & 0x3F;
+    uint8_t b5 =  color        & 0x1F;
+
+    // Convert to 8-bit
+    uint8_t r = (r5 * 527 + 23) >> 6;
+    uint8_t g = (g6 * 259 + 33) >> 6;
+    uint8_t b = (b5 * 527 + 23) >> 6;
+
+    // Weighted luma
+    uint8_t grey = (77 * r + 150 * g + 29 * b) >> 8;
+
+    // Remap from 0–255 to 64–192
+    grey = (grey >> 1) + 64; // Equivalent to (gray * 0.5) + 64
+    //grey = 128 + (grey - 128) * 90 / 100; // white a bit darker, black a bit lighter
+    grey = 128 + (grey - 128) * 70 / 120; // white a bit darker, black a bit lighter
+    // Back to 5/6/5
+    return ((grey >> 3) << 11) | ((grey >> 2) << 5) | (grey >> 3);
+}
+
+/**
+ * @brief Convert an RGB565 colour to the disabled grey using the lookup tables (bit-exact with `disabledGreyReference()`)
+ * 
+ * @param color 
+ * @return uint16_t 
+ */
+inline uint16_t disabledGreyLut(uint16_t color) {
+    uint16_t luma = pgm_read_word(&disabledGreyLuma[(color >> 11) & 0x1F])
+                  + pgm_read_word(&disabledGreyLuma[32 + ((color >> 5) & 0x3F)])
+                  + pgm_read_word(&disabledGreyLuma[96 + (color & 0x1F)]);
+    return pgm_read_word(&disabledGreyRemap[luma >> 8]);
+}
+
+/**
+ * @brief Convert a span of RGB565 pixels (eg a bitmap icon) to disabled grey. Runs of the same colour are only 
+ * looked up once. src and dst may be the same buffer.
+ * 
+ * @param src 
+ * @param dst 
+ * @param count The number of pixels
+ */
+inline void disabledGreySpan(const uint16_t* src, uint16_t* dst, size_t count) {
+    if ( count == 0 ) return;
+    uint16_t lastIn = src[0];
+    uint16_t lastOut = disabledGreyLut(lastIn);
+    for (size_t i = 0; i < count; ++i) {
+        uint16_t c = src[i];
+        if ( c != lastIn ) {
+            lastIn = c;
+            lastOut = disabledGreyLut(c);
+        }
+        dst[i] = lastOut;
+    }
+}
+
+} //namespace
+#endif
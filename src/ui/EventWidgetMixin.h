@@ -11,6 +11,7 @@
 
 #include "Region.h"
 #include "EventTouchScreen.h"
+#include "CallbackDelegate.h"
 
 namespace input_events {
 
@@ -27,16 +28,16 @@ class EventWidgetMixin {
 
     protected:
 
-    #if defined(FUNCTIONAL_SUPPORTED)
+    #if defined(FUNCTIONAL_SUPPORTED) && defined(TOUCH_UI_USE_STD_FUNCTION)
     /**
-     * @brief If <code>std::function</code> is supported, use to create the callback type.
+     * @brief If <code>std::function</code> is supported and <code>TOUCH_UI_USE_STD_FUNCTION</code> is defined, use to create the callback type.
      */
     typedef std::function<void(InputEventType et, Derived &ts)> CallbackFunction;
     #else
     /**
-     * @brief Create the callback type as pointer if <code>std::function</code> is not supported.
+     * @brief By default the callback is a CallbackDelegate which holds a function or class method without heap allocation.
      */
-    typedef void (*CallbackFunction)(InputEventType et, Derived &);
+    typedef CallbackDelegate<InputEventType, Derived &> CallbackFunction;
     #endif
 
     /**
@@ -57,32 +58,24 @@ class EventWidgetMixin {
         callbackIsSet = true;
     }
 
-    #if defined(FUNCTIONAL_SUPPORTED)
     /**
      * @brief Set the Callback function to a class method.
      * 
-     * @details Note: This method is only available if <code>std:function</code> is supported.
-     * 
-     * 
      * @param instance The instance of a class implementing a CallbackFunction method.
      * @param method The class method of type <code>DerivedWidget::CallbackFunction</code> type.
      */
     template <typename T>
     void setCallback(T* instance, void (T::*method)(InputEventType, Derived&)) {
+        #if defined(FUNCTIONAL_SUPPORTED) && defined(TOUCH_UI_USE_STD_FUNCTION)
         // Wrap the method call in a lambda
         callbackFunction = [instance, method](InputEventType et, Derived& ie) {
             (instance->*method)(et, ie); // Call the member function on the instance
         };
+        #else
+        callbackFunction = CallbackFunction(instance, method);
+        #endif
         callbackIsSet = true;
     }
-    #else
-    /// \cond DO_NOT_DOCUMENT
-    template <typename T>
-    void setCallback(T*, void (T::*)(InputEventType, Derived&)) {
-        static_assert(sizeof(T) == 0, "std::function is not supported on this platform. Use setCallback(FunctionPointer) instead.");
-    }
-    /// \endcond
-    #endif
 
     /**
      * @brief Unset a previously set callback function or method.
@@ -0,0 +1,93 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+#ifndef INPUT_EVENTS_FIXED_TRIG_H
+#define INPUT_EVENTS_FIXED_TRIG_H
+
+#include <Arduino.h>
+#include "Coords_s.h"
+
+#ifndef pgm_read_word
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#endif
+
+namespace input_events {
+
+/**
+ * @brief Sine of 0 to 90 degrees in Q15 fixed point (32767 = 1.0). In FixedTrig.cpp.
+ */
+extern const int16_t sinQ15Table[91] PROGMEM;
+
+/**
+ * @brief Sine of whole degrees (any value, negative or > 360) in Q15 fixed point, ie -32767 to 32767.
+ * 
+ * @param degrees 
+ * @return int16_t 
+ */
+inline int16_t sinQ15(int16_t degrees) {
+    int16_t d = degrees % 360;
+    if ( d < 0 ) d += 360;
+    if ( d <= 90 ) return static_cast<int16_t>(pgm_read_word(&sinQ15Table[d]));
+    if ( d <= 180 ) return static_cast<int16_t>(pgm_read_word(&sinQ15Table[180 - d]));
+    if ( d <= 270 ) return -static_cast<int16_t>(pgm_read_word(&sinQ15Table[d - 180]));
+    return -static_cast<int16_t>(pgm_read_word(&sinQ15Table[360 - d]));
+}
+
+/**
+ * @brief Cosine of whole degrees in Q15 fixed point
+ * 
+ * @param degrees 
+ * @return int16_t 
+ */
+inline int16_t cosQ15(int16_t degrees) {
+    return sinQ15(static_cast<int16_t>(degrees % 360 + 90));
+}
+
+/**
+ * @brief Multiply value by a Q15 fraction, rounded to the nearest integer
+ * 
+ * @param value 
+ * @param q15 
+ * @return int16_t 
+ */
+inline int16_t mulQ15(int16_t value, int16_t q15) {
+    return static_cast<int16_t>((static_cast<int32_t>(value) * q15 + 0x4000) >> 15);
+}
+
+/**
+ * @brief Return the point on a circle of radius around centre. 0 degrees is 3 o'clock and angles increase 
+ * clockwise (as y increases down the display).
+ * 
+ * @param centre 
+ * @param radius 
+ * @param degrees 
+ * @return Coords_s 
+ */
+inline Coords_s pointOnArc(const Coords_s& centre, int16_t radius, int16_t degrees) {
+    return Coords_s(u16(centre.x + mulQ15(radius, cosQ15(degrees))), 
+                    u16(centre.y + mulQ15(radius, sinQ15(degrees))));
+}
+
+/**
+ * @brief Fill points with the vertices of a regular polygon
+ * 
+ * @param centre 
+ * @param radius The distance from centre to each vertex
+ * @param sides The number of vertices written to points
+ * @param startDegrees The angle of the first vertex (see `pointOnArc()`)
+ * @param points Must hold at least sides Coords_s
+ */
+inline void polygonPoints(const Coords_s& centre, int16_t radius, uint8_t sides, int16_t startDegrees, Coords_s* points) {
+    for (uint8_t i = 0; i < sides; ++i) {
+        int16_t d = static_cast<int16_t>(startDegrees + (360L * i + sides / 2) / sides);
+        points[i] = pointOnArc(centre, radius, d);
+    }
+}
+
+} //namespace
+#endif
@@ -0,0 +1,54 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+#ifndef INPUT_EVENTS_IBAND_DRAWABLE_H
+#define INPUT_EVENTS_IBAND_DRAWABLE_H
+
+#include <Arduino.h>
+#include "Region.h"
+#include "BandCanvas.h"
+
+namespace input_events {
+
+/**
+ * @brief The interface for anything that can be drawn by a BandRenderer. Implemented by `BandWidgetMixin`.
+ * 
+ */
+class IBandDrawable {
+
+    public:
+
+    /**
+     * @brief The Region of the display that will be drawn. `drawBand()` is only called for bands that intersect it.
+     * 
+     * @return Region 
+     */
+    virtual Region getDrawRegion() = 0;
+
+    /**
+     * @brief Draw to the canvas. The canvas is a band of the display and all drawing is clipped to it, so
+     * draw exactly as if drawing the whole Region to the display. Called once for each band.
+     * 
+     * @param canvas 
+     */
+    virtual void drawBand(BandCanvas& canvas) = 0;
+
+    /**
+     * @brief Return false to skip drawing (eg if hidden)
+     * 
+     * @return true 
+     * @return false 
+     */
+    virtual bool isBandVisible() { return true; }
+
+    virtual ~IBandDrawable() {}
+
+};
+
+} //namespace
+#endif
@@ -0,0 +1,201 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+#ifndef INPUT_EVENTS_ICON_CACHE_H
+#define INPUT_EVENTS_ICON_CACHE_H
+
+#ifndef ICON_CACHE_MAX_ENTRIES
+/**
+ * @brief The maximum number of icons held by an `IconCache`, regardless of the byte budget
+ */
+#define ICON_CACHE_MAX_ENTRIES 16
+#endif
+
+#include <Arduino.h>
+#include <string.h>
+#include "Region.h"
+#include "BaseIcon.h"
+#include "BandCanvas.h"
+#include "ClipStack.h"
+
+namespace input_events {
+
+/**
+ * @brief Caches icons as RGB565 bitmaps so repeated draws of the same icon, size and params are a single block 
+ * write instead of re-running the icon's drawing primitives.
+ * 
+ * @details Only icons that implement `BaseIcon::drawIconCanvas()` and return true from `BaseIcon::isCacheable()` 
+ * can be cached, all others are drawn directly with `BaseIcon::draw()`. Bitmaps are keyed by icon, size and the 
+ * full IconParams. Cached icons are opaque: the region is filled with params.bg before the icon is drawn.
+ * 
+ * Bitmaps are held in a fixed arena of BudgetBytes. When a new bitmap does not fit, the least recently used 
+ * bitmaps are evicted and the arena is compacted. Icons larger than the arena are drawn directly.
+ * 
+ * ```
+ * void pushIcon(const Region& r, const uint16_t* pixels) {
+ *     tft.pushImage(r.x(), r.y(), r.w(), r.h(), pixels);
+ * }
+ * IconCache<4096> iconCache(pushIcon);
+ * ...
+ * iconCache.draw(saveIcon, Region(10, 10, 32, 32), IconParams(TFT_WHITE, TFT_BLUE));
+ * ```
+ * 
+ * @tparam BudgetBytes The size of the bitmap arena in bytes
+ */
+template<size_t BudgetBytes>
+class IconCache {
+
+    public:
+
+    /**
+     * @brief Construct an IconCache
+     * 
+     * @param writer The function or method that writes a block of pixels to the display
+     */
+    explicit IconCache(PixelBlockWriter writer) : 
+        writer(writer)
+        {}
+
+    /**
+     * @brief Draw icon in region with params, from the cache if possible.
+     * 
+     * @param icon 
+     * @param region 
+     * @param params 
+     */
+    void draw(const BaseIcon& icon, Region region, IconParams params) {
+        Region drawRegion = region;
+        IconParams drawParams = params;
+        icon.prepare(drawRegion, drawParams);
+        if ( !clipStack().isVisible(drawRegion) ) return;
+        size_t index = find(icon, drawRegion, params);
+        if ( index == InvalidIndex ) {
+            misses++;
+            index = rasterise(icon, drawRegion, params, drawParams);
+            if ( index == InvalidIndex ) {
+                icon.draw(region, params);
+                return;
+            }
+        } else {
+            hits++;
+        }
+        entries[index].lastUsed = ++tick;
+        if ( writer ) writer(drawRegion, &arena[entries[index].offset]);
+    }
+
+    /**
+     * @brief Remove all cached bitmaps
+     * 
+     */
+    void clear() {
+        count = 0;
+        used = 0;
+    }
+
+    /**
+     * @brief Return the number of cached bitmaps
+     * 
+     * @return size_t 
+     */
+    size_t size() const { return count; }
+
+    /**
+     * @brief Return the number of bytes used by cached bitmaps
+     * 
+     * @return size_t 
+     */
+    size_t usedBytes() const { return used * sizeof(uint16_t); }
+
+    /**
+     * @brief Return the number of draws from the cache
+     * 
+     * @return uint32_t 
+     */
+    uint32_t hitCount() const { return hits; }
+
+    /**
+     * @brief Return the number of draws not in the cache
+     * 
+     * @return uint32_t 
+     */
+    uint32_t missCount() const { return misses; }
+
+    private:
+
+    static constexpr size_t InvalidIndex = static_cast<size_t>(-1);
+    static constexpr size_t ArenaPixels = BudgetBytes / sizeof(uint16_t);
+
+    struct Entry {
+        const BaseIcon* icon;
+        uint16_t w;
+        uint16_t h;
+        IconParams params; ///< As passed to draw(), before prepare()
+        size_t offset; ///< In pixels
+        uint32_t lastUsed;
+
+        bool matches(const BaseIcon& icon_, const Region& region, const IconParams& params_) const {
+            return icon == &icon_ && w == region.w() && h == region.h() && params == params_;
+        }
+    };
+
+    size_t find(const BaseIcon& icon, const Region& region, const IconParams& params) const {
+        for (size_t i = 0; i < count; ++i) {
+            if ( entries[i].matches(icon, region, params) ) return i;
+        }
+        return InvalidIndex;
+    }
+
+    size_t rasterise(const BaseIcon& icon, const Region& region, const IconParams& params, const IconParams& drawParams) {
+        size_t pixels = static_cast<size_t>(region.w()) * region.h();
+        if ( pixels == 0 || pixels > ArenaPixels || !icon.isCacheable() ) return InvalidIndex; //Before evicting
+        while ( count > 0 && (count >= ICON_CACHE_MAX_ENTRIES || used + pixels > ArenaPixels) ) {
+            evictLeastRecentlyUsed();
+        }
+        BandCanvas canvas(&arena[used], region);
+        canvas.fill(drawParams.bg);
+        if ( !icon.drawIconCanvas(canvas, region, drawParams) ) return InvalidIndex;
+        Entry& e = entries[count];
+        e.icon = &icon;
+        e.w = region.w();
+        e.h = region.h();
+        e.params = params;
+        e.offset = used;
+        used += pixels;
+        return count++;
+    }
+
+    //Entries are held in arena order, so removing one and moving the following bitmaps down compacts the arena
+    void evictLeastRecentlyUsed() {
+        size_t lru = 0;
+        for (size_t i = 1; i < count; ++i) {
+            if ( entries[i].lastUsed < entries[lru].lastUsed ) lru = i;
+        }
+        size_t pixels = static_cast<size_t>(entries[lru].w) * entries[lru].h;
+        size_t start = entries[lru].offset;
+        memmove(&arena[start], &arena[start + pixels], (used - start - pixels) * sizeof(uint16_t));
+        used -= pixels;
+        for (size_t i = lru; i < count - 1; ++i) {
+            entries[i] = entries[i + 1];
+            entries[i].offset -= pixels;
+        }
+        count--;
+    }
+
+    PixelBlockWriter writer;
+    Entry entries[ICON_CACHE_MAX_ENTRIES];
+    size_t count = 0;
+    size_t used = 0; ///< In pixels
+    uint32_t tick = 0;
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+    uint16_t arena[ArenaPixels];
+
+};
+
+} //namespace
+#endif
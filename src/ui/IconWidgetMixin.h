@@ -9,6 +9,7 @@
 #ifndef INPUT_EVENTS_ICON_WIDGET_MIXIN_H
 #define INPUT_EVENTS_ICON_WIDGET_MIXIN_H
 #include "BaseIcon.h"
+#include "Theme.h"
 
 namespace input_events {
 
@@ -45,12 +46,27 @@ class IconWidgetMixin {
     }
 
     /**
-     * @brief Set the IconParams
+     * @brief Set the IconParams. These are held once in the `Theme` and shared with other widgets using 
+     * the same IconParams. The previous IconParams are released first, so changing the params of a widget 
+     * that was the only user of its style reuses that style (and keeps its index).
      * 
      * @param newIconParams 
+     * @return true 
+     * @return false If the Theme is full (see THEME_MAX_STYLES) and the IconParams are unchanged
      */
-    void setIconParams(input_events::IconParams newIconParams) {
-        iconParams = newIconParams;
+    bool setIconParams(input_events::IconParams newIconParams) {
+        Theme& theme = Theme::current();
+        if ( theme.style(iconStyle) == newIconParams ) return true;
+        theme.release(iconStyle);
+        uint8_t style = theme.intern(newIconParams);
+        if ( style == Theme::InvalidStyle ) {
+            theme.retain(iconStyle);
+            return false;
+        }
+        iconStyle = style;
+        Derived* self = static_cast<Derived*>(this);
+        self->redrawRequired();
+        return true;
     }
 
     /**
@@ -59,13 +75,58 @@ class IconWidgetMixin {
      * @return input_events::IconParams 
      */
     input_events::IconParams getIconParams() {
-        return iconParams;
+        return Theme::current().style(iconStyle);
+    }
+
+    /**
+     * @brief Set the index of the IconParams in the Theme
+     * 
+     * @param style 
+     */
+    void setIconStyle(uint8_t style) {
+        if ( style == iconStyle ) return;
+        Theme::current().retain(style);
+        Theme::current().release(iconStyle);
+        iconStyle = style;
+        Derived* self = static_cast<Derived*>(this);
+        self->redrawRequired();
     }
 
+    /**
+     * @brief Get the index of the IconParams in the Theme
+     * 
+     * @return uint8_t 
+     */
+    uint8_t getIconStyle() { return iconStyle; }
+
     protected:
 
+    /**
+     * @brief Call from the derived widget's `onThemeChanged()` to redraw if the icon's style has changed
+     * 
+     * @param changedStyles 
+     */
+    void iconOnThemeChanged(uint32_t changedStyles) {
+        if ( changedStyles & (1UL << iconStyle) ) {
+            Derived* self = static_cast<Derived*>(this);
+            self->redrawRequired();
+        }
+    }
+
+    /**
+     * @brief The IconParams, for widgets written when they were held in an `iconParams` member. This is read 
+     * only: `iconParams.fg = ...` no longer compiles and must use setIconParams() (see ui/README.md).
+     * 
+     * @deprecated Use getIconParams()
+     * @return const input_events::IconParams& 
+     */
+    __attribute__((deprecated("use getIconParams()")))
+    const input_events::IconParams& iconParams() const {
+        return Theme::current().style(iconStyle);
+    }
+
     const Icon* icon = nullptr; ///< a reference to the icon
-    input_events::IconParams iconParams; ///< a copy of the parameters
+    uint8_t iconStyle = 0; ///< the index of the parameters in the Theme
 
 
     protected:
@@ -75,6 +136,30 @@ class IconWidgetMixin {
      */
     IconWidgetMixin() {} 
 
+    /**
+     * @brief Copies share the style
+     * 
+     */
+    IconWidgetMixin(const IconWidgetMixin& other) : 
+        icon(other.icon),
+        iconStyle(other.iconStyle) {
+        Theme::current().retain(iconStyle);
+    }
+
+    /**
+     * @brief Assignment shares the style
+     * 
+     */
+    IconWidgetMixin& operator=(const IconWidgetMixin& other) {
+        Theme::current().retain(other.iconStyle);
+        Theme::current().release(iconStyle);
+        icon = other.icon;
+        iconStyle = other.iconStyle;
+        return *this;
+    }
+
+    ~IconWidgetMixin() { Theme::current().release(iconStyle); }
+
     
 };
 
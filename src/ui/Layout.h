@@ -0,0 +1,309 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+#ifndef INPUT_EVENTS_LAYOUT_H
+#define INPUT_EVENTS_LAYOUT_H
+
+#include <Arduino.h>
+#include "Region.h"
+
+#ifndef TOUCH_UI_CONSTEXPR14
+#if __cplusplus >= 201402L
+/**
+ * @brief constexpr if the compiler supports C++14 relaxed constexpr (loops etc), otherwise inline.
+ */
+#define TOUCH_UI_CONSTEXPR14 constexpr
+#else
+#define TOUCH_UI_CONSTEXPR14 inline
+#endif
+#endif
+
+namespace input_events {
+
+/**
+ * @brief Layout helpers that split a Region into rows, columns or grids of Regions.
+ * 
+ * @details With C++14 (or later) all layout functions are <code>constexpr</code> so a whole screen layout can be 
+ * calculated at compile time and checked with <code>static_assert</code>:
+ * ```
+ * using namespace input_events::layout;
+ * constexpr Region screen(0, 0, 320, 240);
+ * constexpr auto bands = rows(screen, { fixed(30), 1, fixed(40) }, 2); // Header, body, footer with 2px gaps
+ * constexpr auto keys = grid<4, 3>(inset(bands[1], 4), 2, 2);         // 4 rows x 3 columns in the padded body
+ * static_assert(fitsWithin(keys, screen), "Keys off screen");
+ * static_assert(noOverlaps(keys), "Keys overlap");
+ * ```
+ * Weighted slots share the space left after fixed slots and gaps. Any remainder from integer division is given 
+ * to the last weighted slot, so the slots always fill the Region (the same as WidgetRowContainer 'widenLast').
+ */
+namespace layout {
+
+/**
+ * @brief A slot in a row or column - either a fixed number of pixels or a weighted share of the remaining space.
+ * 
+ */
+struct Slot {
+    uint16_t px = 0;     ///< The fixed size in pixels (only used if weight is 0)
+    uint8_t weight = 1;  ///< The share of the space remaining after fixed slots and gaps. 0 = fixed size.
+
+    /**
+     * @brief Construct a weighted Slot. Implicit, so a weight can be used directly in a list of Slots.
+     * 
+     * @param weight 
+     */
+    constexpr Slot(uint8_t weight = 1) : px(0), weight(weight) {}
+
+    /**
+     * @brief Construct a Slot with a fixed size and weight
+     * 
+     * @param px 
+     * @param weight 
+     */
+    constexpr Slot(uint16_t px, uint8_t weight) : px(px), weight(weight) {}
+};
+
+/**
+ * @brief Create a fixed size Slot
+ * 
+ * @param px 
+ * @return Slot 
+ */
+constexpr Slot fixed(uint16_t px) { return Slot(px, 0); }
+
+/**
+ * @brief Create a weighted Slot
+ * 
+ * @param weight 
+ * @return Slot 
+ */
+constexpr Slot weighted(uint8_t weight) { return Slot(weight); }
+
+/**
+ * @brief A fixed size array of Regions returned by the layout functions
+ * 
+ * @tparam N 
+ */
+template<size_t N>
+struct Regions {
+    Region region[N]; ///< The Regions
+
+    /**
+     * @brief Return the Region at index i
+     */
+    constexpr const Region& operator[](size_t i) const { return region[i]; }
+
+    /**
+     * @brief The number of Regions
+     */
+    static constexpr size_t size() { return N; }
+
+    /**
+     * @brief For range based for loops
+     */
+    constexpr const Region* begin() const { return region; }
+
+    /**
+     * @brief For range based for loops
+     */
+    constexpr const Region* end() const { return region + N; }
+};
+
+/**
+ * @brief Split a length into slots separated by gap (the core of all layouts).
+ * 
+ * @param start The absolute start position (x or y)
+ * @param length The length to split (w or h)
+ * @param slots The slot definitions
+ * @param count The number of slots
+ * @param gap The gap between slots
+ * @param pos Receives the start position of each slot
+ * @param size Receives the size of each slot
+ */
+TOUCH_UI_CONSTEXPR14 void split(uint16_t start, uint16_t length, const Slot* slots, size_t count, uint16_t gap,
+                                uint16_t* pos, uint16_t* size) {
+    uint32_t fixedTotal = 0;
+    uint32_t weightTotal = 0;
+    size_t lastWeighted = count;
+    for (size_t i = 0; i < count; ++i) {
+        if ( slots[i].weight == 0 ) {
+            fixedTotal += slots[i].px;
+        } else {
+            weightTotal += slots[i].weight;
+            lastWeighted = i;
+        }
+    }
+    uint32_t used = fixedTotal + (count > 1 ? static_cast<uint32_t>(gap) * (count - 1) : 0);
+    uint32_t flexible = used < length ? length - used : 0;
+    uint32_t allotted = 0;
+    uint32_t p = start;
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t s = 0;
+        if ( slots[i].weight == 0 ) {
+            s = slots[i].px;
+        } else if ( i == lastWeighted ) {
+            s = flexible - allotted; //Remainder to last weighted slot
+        } else {
+            s = flexible * slots[i].weight / weightTotal;
+            allotted += s;
+        }
+        pos[i] = static_cast<uint16_t>(p);
+        size[i] = static_cast<uint16_t>(s);
+        p += s + gap;
+    }
+}
+
+/**
+ * @brief Return a Region inset by top, right, bottom and left pixels (CSS order). Width and height are at least 1.
+ * 
+ */
+constexpr Region inset(const Region& r, uint16_t top, uint16_t right, uint16_t bottom, uint16_t left) {
+    return Region(r.x() + left, r.y() + top,
+                  r.w() > left + right ? r.w() - left - right : 1,
+                  r.h() > top + bottom ? r.h() - top - bottom : 1);
+}
+
+/**
+ * @brief Return a Region inset by vertical and horizontal pixels
+ * 
+ */
+constexpr Region inset(const Region& r, uint16_t vertical, uint16_t horizontal) {
+    return inset(r, vertical, horizontal, vertical, horizontal);
+}
+
+/**
+ * @brief Return a Region inset by all pixels on all sides
+ * 
+ */
+constexpr Region inset(const Region& r, uint16_t all) {
+    return inset(r, all, all, all, all);
+}
+
+/**
+ * @brief Split area into columns defined by slots, left to right
+ * 
+ * @param area 
+ * @param slots eg <code>{ 1, 2, fixed(40) }</code>
+ * @param gap Pixels between columns
+ * @return Regions<N> 
+ */
+template<size_t N>
+TOUCH_UI_CONSTEXPR14 Regions<N> columns(const Region& area, const Slot (&slots)[N], uint16_t gap = 0) {
+    Regions<N> out{};
+    uint16_t pos[N] = {};
+    uint16_t size[N] = {};
+    split(area.x(), area.w(), slots, N, gap, pos, size);
+    for (size_t i = 0; i < N; ++i) {
+        out.region[i] = Region(pos[i], area.y(), size[i], area.h());
+    }
+    return out;
+}
+
+/**
+ * @brief Split area into N equal columns
+ * 
+ * @param area 
+ * @param gap Pixels between columns
+ * @return Regions<N> 
+ */
+template<size_t N>
+TOUCH_UI_CONSTEXPR14 Regions<N> columns(const Region& area, uint16_t gap = 0) {
+    Slot slots[N] = {};
+    return columns<N>(area, slots, gap);
+}
+
+/**
+ * @brief Split area into rows defined by slots, top to bottom
+ * 
+ * @param area 
+ * @param slots eg <code>{ fixed(30), 1, fixed(40) }</code>
+ * @param gap Pixels between rows
+ * @return Regions<N> 
+ */
+template<size_t N>
+TOUCH_UI_CONSTEXPR14 Regions<N> rows(const Region& area, const Slot (&slots)[N], uint16_t gap = 0) {
+    Regions<N> out{};
+    uint16_t pos[N] = {};
+    uint16_t size[N] = {};
+    split(area.y(), area.h(), slots, N, gap, pos, size);
+    for (size_t i = 0; i < N; ++i) {
+        out.region[i] = Region(area.x(), pos[i], area.w(), size[i]);
+    }
+    return out;
+}
+
+/**
+ * @brief Split area into N equal rows
+ * 
+ * @param area 
+ * @param gap Pixels between rows
+ * @return Regions<N> 
+ */
+template<size_t N>
+TOUCH_UI_CONSTEXPR14 Regions<N> rows(const Region& area, uint16_t gap = 0) {
+    Slot slots[N] = {};
+    return rows<N>(area, slots, gap);
+}
+
+/**
+ * @brief Split area into an equal grid of NumRows x NumCols. Regions are in row order (index = row * NumCols + col).
+ * 
+ * @param area 
+ * @param colGap Pixels between columns
+ * @param rowGap Pixels between rows
+ * @return Regions<NumRows * NumCols>
+ */
+template<size_t NumRows, size_t NumCols>
+TOUCH_UI_CONSTEXPR14 Regions<NumRows * NumCols> grid(const Region& area, uint16_t colGap = 0, uint16_t rowGap = 0) {
+    Regions<NumRows * NumCols> out{};
+    Regions<NumRows> r = rows<NumRows>(area, rowGap);
+    Regions<NumCols> c = columns<NumCols>(area, colGap);
+    for (size_t row = 0; row < NumRows; ++row) {
+        for (size_t col = 0; col < NumCols; ++col) {
+            out.region[row * NumCols + col] = Region(c[col].x(), r[row].y(), c[col].w(), r[row].h());
+        }
+    }
+    return out;
+}
+
+/**
+ * @brief Returns true if all regions are fully contained by bounds
+ * 
+ * @param regions 
+ * @param bounds 
+ * @return true 
+ * @return false 
+ */
+template<size_t N>
+TOUCH_UI_CONSTEXPR14 bool fitsWithin(const Regions<N>& regions, const Region& bounds) {
+    for (size_t i = 0; i < N; ++i) {
+        if ( !bounds.contains(regions[i]) ) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Returns true if no two regions overlap
+ * 
+ * @param regions 
+ * @return true 
+ * @return false 
+ */
+template<size_t N>
+TOUCH_UI_CONSTEXPR14 bool noOverlaps(const Regions<N>& regions) {
+    for (size_t i = 0; i < N; ++i) {
+        for (size_t j = i + 1; j < N; ++j) {
+            if ( regions[i].intersects(regions[j]) ) return false;
+        }
+    }
+    return true;
+}
+
+} //namespace layout
+
+} //namespace
+#endif
@@ -98,6 +98,12 @@ class Region {
     constexpr Region(const Region& region)
         : Region(region._x, region._y, region._w, region._h) {}
 
+    /**
+     * @brief Assign another Region (declared because the copy constructor is)
+     * 
+     */
+    Region& operator=(const Region& region) = default;
+
     ///@}
 
     ///@{ 
@@ -386,6 +392,19 @@ constexpr bool intersects(const Region& other, bool inclusive = true) const {
 }
 
 
+/**
+ * @brief Return the Region common to this Region and another Region. Only valid if the Regions intersects().
+ * 
+ * @param other 
+ * @return Region 
+ */
+constexpr Region intersection(const Region& other) const {
+    return Region(_x > other._x ? _x : other._x,
+                  _y > other._y ? _y : other._y,
+                  (r() < other.r() ? r() : other.r()) - (_x > other._x ? _x : other._x) + 1,
+                  (b() < other.b() ? b() : other.b()) - (_y > other._y ? _y : other._y) + 1);
+}
+
     // constexpr bool intersects(const Region& r, bool inclusive = true) const {
     //     if (inclusive) {
     //         return !(
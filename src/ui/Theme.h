@@ -0,0 +1,180 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+#ifndef INPUT_EVENTS_THEME_H
+#define INPUT_EVENTS_THEME_H
+
+#ifndef THEME_MAX_STYLES
+/**
+ * @brief The maximum number of styles in the Theme (max 32)
+ */
+#define THEME_MAX_STYLES 16
+#endif
+
+#include <Arduino.h>
+#include "BaseIcon.h"
+
+namespace input_events {
+
+/**
+ * @brief A table of shared IconParams (styles). Widgets hold a one byte style index instead of their own 
+ * copy of IconParams, and identical IconParams are only held once (interned).
+ * 
+ * @details Interned styles are reference counted with `retain()` and `release()`, and a style no longer used by 
+ * any widget is reused by the next `intern()`. Styles set with `setStyle()` or `loadTable()` are fixed: they are 
+ * kept until replaced and are never matched or reused by `intern()`, so changing a fixed style only changes the 
+ * widgets that chose it with `setIconStyle()`. An interned style still in use is never replaced by `setStyle()`, 
+ * so load the theme before widgets set their own IconParams.
+ * 
+ * Style 0 is always the default IconParams. A theme can be loaded from a const table (which the compiler places 
+ * in flash on most 32 bit MCUs). The table is copied, so styles can be changed with `setStyle()` and AVR 
+ * `PROGMEM` is not dereferenced:
+ * ```
+ * constexpr IconParams darkTheme[] = {
+ *     IconParams(TFT_WHITE, TFT_BLACK),   // 0 Default
+ *     IconParams(TFT_BLACK, TFT_ORANGE),  // 1 Highlight
+ * };
+ * uint32_t changed = Theme::current().loadTable(darkTheme, 2);
+ * screen.onThemeChanged(changed); // Only widgets using a changed style are redrawn
+ * ```
+ * 
+ */
+class Theme {
+
+    public:
+
+    static_assert(THEME_MAX_STYLES > 0 && THEME_MAX_STYLES <= 32, "THEME_MAX_STYLES must be 1 to 32");
+
+    static const uint8_t InvalidStyle = 0xFF; ///< Returned by intern() when the table is full
+
+    /**
+     * @brief The shared Theme used by widgets
+     * 
+     * @return Theme& 
+     */
+    static Theme& current() {
+        static Theme theme;
+        return theme;
+    }
+
+    /**
+     * @brief Return the index of an interned style equal to params, adding it if not found, and retain it. Call 
+     * `release()` when the style is no longer used. Fixed styles are not matched.
+     * 
+     * @param params 
+     * @return uint8_t The style index or InvalidStyle if the table is full
+     */
+    uint8_t intern(const IconParams& params) {
+        uint8_t unused = InvalidStyle;
+        for (uint8_t i = 0; i < count; ++i) {
+            if ( isFixed(i) ) continue;
+            if ( styles[i] == params ) {
+                retain(i);
+                return i;
+            }
+            if ( unused == InvalidStyle && isUnused(i) ) unused = i;
+        }
+        if ( unused == InvalidStyle ) {
+            if ( count >= THEME_MAX_STYLES ) return InvalidStyle;
+            unused = count++;
+        }
+        styles[unused] = params;
+        refs[unused] = 1;
+        return unused;
+    }
+
+    /**
+     * @brief Add a reference to the style at index
+     * 
+     * @param index 
+     */
+    void retain(uint8_t index) {
+        if ( index < count && refs[index] < MaxRefs ) refs[index]++;
+    }
+
+    /**
+     * @brief Remove a reference to the style at index. When no references remain, an interned style may be 
+     * reused by `intern()`.
+     * 
+     * @param index 
+     */
+    void release(uint8_t index) {
+        if ( index < count && refs[index] > 0 && refs[index] < MaxRefs ) refs[index]--; //A saturated count is kept
+    }
+
+    /**
+     * @brief Return the style at index (or the default style if index is invalid)
+     * 
+     * @param index 
+     * @return const IconParams&
+     */
+    const IconParams& style(uint8_t index) const {
+        return styles[index < count ? index : 0];
+    }
+
+    /**
+     * @brief Replace the style at index, eg to change the theme's highlight colour. The style becomes fixed. An 
+     * interned style that is still in use is not replaced.
+     * 
+     * @param index 
+     * @param params 
+     * @return uint32_t A mask with the index bit set if the style changed, for `BaseWidget::onThemeChanged()`
+     */
+    uint32_t setStyle(uint8_t index, const IconParams& params) {
+        if ( index >= THEME_MAX_STYLES ) return 0;
+        if ( index < count && !isFixed(index) && refs[index] > 0 ) return 0;
+        if ( index >= count ) count = index + 1;
+        fixed |= 1UL << index;
+        if ( styles[index] == params ) return 0;
+        styles[index] = params;
+        return 1UL << index;
+    }
+
+    /**
+     * @brief Replace the styles from index 0 with table
+     * 
+     * @param table 
+     * @param tableSize 
+     * @return uint32_t A mask with a bit set for each style that changed, for `BaseWidget::onThemeChanged()`
+     */
+    uint32_t loadTable(const IconParams* table, uint8_t tableSize) {
+        uint32_t changed = 0;
+        for (uint8_t i = 0; i < tableSize && i < THEME_MAX_STYLES; ++i) {
+            changed |= setStyle(i, table[i]);
+        }
+        return changed;
+    }
+
+    /**
+     * @brief Return the number of styles
+     * 
+     * @return uint8_t 
+     */
+    uint8_t size() const { return count; }
+
+    private:
+
+    static const uint8_t MaxRefs = 0xFF;
+
+    bool isFixed(uint8_t index) const {
+        return fixed & (1UL << index);
+    }
+
+    bool isUnused(uint8_t index) const {
+        return refs[index] == 0 && !isFixed(index);
+    }
+
+    IconParams styles[THEME_MAX_STYLES];
+    uint8_t refs[THEME_MAX_STYLES] = {}; ///< Widgets using each style
+    uint32_t fixed = 1; ///< Styles set by setStyle() and loadTable(), never reused by intern()
+    uint8_t count = 1; //Style 0 is the default IconParams
+
+};
+
+} //namespace
+#endif
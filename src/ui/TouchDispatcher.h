@@ -0,0 +1,289 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+#ifndef INPUT_EVENTS_TOUCH_DISPATCHER_H
+#define INPUT_EVENTS_TOUCH_DISPATCHER_H
+
+#ifndef TOUCH_DISPATCHER_DEFAULT_MAX
+/**
+ * @brief The default maximum number of touch widgets in a `TouchDispatcher`
+ */
+#define TOUCH_DISPATCHER_DEFAULT_MAX 10
+#endif
+
+#include <Arduino.h>
+#include "EventTouchScreen.h"
+#include "BaseWidget.h"
+#include "WidgetContainer.h"
+
+namespace input_events {
+
+/**
+ * @brief Dispatches EventTouchScreen events to touch widgets with pointer capture.
+ * 
+ * @details The widget hit by the start touch point on PRESSED 'captures' the touch and receives all following
+ * DRAGGED, LONG_PRESS, RELEASED and DRAGGED_RELEASED events, even if the touch point has moved outside of its Region.
+ * Capture ends on RELEASED or DRAGGED_RELEASED. The click events (CLICKED, DOUBLE_CLICKED etc) that fire after
+ * release go to the same widget. All other events (ENABLED, DISABLED, IDLE) are sent to all widgets.
+ * 
+ * Any widget derived from BaseWidget and `TouchWidgetMixin` can be added. The dispatcher calls the widget's 
+ * onTouchEvent() and isTouchHit() through a small per-widget entry, so touch widgets do not need a vtable for touch.
+ * 
+ * Widgets are hit tested from the top down. After `attachContainer()`, the container's z-order is used, so it does
+ * not need to be repeated here. Otherwise (and for widgets that are not in the container, which are hit tested 
+ * below those that are), the z-order passed to addWidget() is used and, for the same z-order, the last widget 
+ * added is considered 'on top'.
+ * 
+ * Typically called from the EventTouchScreen callback:
+ * ```
+ * void onTouchEvent(InputEventType et, EventTouchScreen& ts) {
+ *     touchDispatcher.dispatch(et, ts);
+ * }
+ * ```
+ * 
+ */
+template<size_t maxWidgets = TOUCH_DISPATCHER_DEFAULT_MAX>
+class TouchDispatcher {
+
+    public:
+
+    static constexpr size_t InvalidIndex = static_cast<size_t>(-1); ///< Define invalid value as max size
+
+    /**
+     * @brief Dispatch a touch event to the capturing widget (or all widgets for non-touch events)
+     * 
+     * @param et 
+     * @param touchPanel 
+     * @return true If the event was fully handled
+     * @return false If no widget handled the event
+     */
+    bool dispatch(InputEventType et, EventTouchScreen& touchPanel) {
+        switch (et) {
+            case InputEventType::PRESSED :
+                captured = hitTest(touchPanel.getStartTouchPoint());
+                lastCaptured = captured;
+                return send(captured, et, touchPanel);
+            case InputEventType::DRAGGED :
+            case InputEventType::LONG_PRESS :
+                return send(captured, et, touchPanel);
+            case InputEventType::RELEASED :
+            case InputEventType::DRAGGED_RELEASED : {
+                BaseWidget* widget = captured;
+                captured = nullptr;
+                return send(widget, et, touchPanel);
+            }
+            case InputEventType::CLICKED :
+            case InputEventType::DOUBLE_CLICKED :
+            case InputEventType::MULTI_CLICKED :
+            case InputEventType::LONG_CLICKED :
+                return send(lastCaptured, et, touchPanel);
+            default: {
+                bool handled = false;
+                for (size_t i = 0; i < count; ++i) {
+                    handled |= entries[i].onTouch(entries[i].widget, et, touchPanel);
+                }
+                return handled;
+            }
+        }
+    }
+
+    /**
+     * @brief Return the widget that is the top-most hit for coords, or nullptr if none.
+     * 
+     * @param coords 
+     * @return BaseWidget* 
+     */
+    BaseWidget* hitTest(const Coords_s& coords) {
+        size_t index = hitIndex(coords);
+        return index == InvalidIndex ? nullptr : entries[index].widget;
+    }
+
+    /**
+     * @brief Hit test in the z-order of container (the same order as `WidgetContainer::widgetAt()`), so changes
+     * made with `WidgetContainer::setZOrder()` apply to touch too. The container must outlive the dispatcher (or be 
+     * detached with nullptr).
+     * 
+     * @param container 
+     */
+    template<size_t maxContainerWidgets>
+    void attachContainer(WidgetContainer<maxContainerWidgets>* container) {
+        this->container = container;
+        containerIndexOf = container ? &indexIn<WidgetContainer<maxContainerWidgets>> : nullptr;
+    }
+
+    /**
+     * @brief Return the widget that currently has touch capture or nullptr
+     * 
+     * @return BaseWidget* 
+     */
+    BaseWidget* getCapture() { return captured; }
+
+    /**
+     * @brief Returns true if widget currently has touch capture
+     * 
+     * @param widget 
+     * @return true 
+     * @return false 
+     */
+    bool hasCapture(const BaseWidget* widget) { return widget != nullptr && getCapture() == widget; }
+
+    /**
+     * @brief Release touch capture. The remaining events of the current touch will not be dispatched.
+     * 
+     */
+    void releaseCapture() {
+        captured = nullptr;
+        lastCaptured = nullptr;
+    }
+
+    /**
+     * @brief Add a touch widget (derived from BaseWidget and TouchWidgetMixin) to the dispatcher. Capture is kept, 
+     * so a widget can be added by a touch handler (eg a popup on PRESSED).
+     * 
+     * @param widget 
+     * @param z The z-order. Higher values are hit tested first. Not used if the widget is in an attached container.
+     * @return size_t The index or InvalidIndex if full
+     */
+    template<typename T>
+    size_t addWidget(T* widget, uint8_t z = 0) {
+        if ( widget == nullptr || count >= maxWidgets ) return InvalidIndex;
+        size_t index = count;
+        while ( index > 0 && zOrder[index - 1] > z ) { //Shift higher widgets up
+            entries[index] = entries[index - 1];
+            zOrder[index] = zOrder[index - 1];
+            --index;
+        }
+        entries[index].widget = widget;
+        entries[index].onTouch = &onTouchEventOf<T>;
+        entries[index].isHit = &isTouchHitOf<T>;
+        zOrder[index] = z;
+        count++;
+        return index;
+    }
+
+    /**
+     * @brief Remove a touch widget. If it has capture (or captured the last touch), capture is released. Capture 
+     * by any other widget is kept.
+     * 
+     * @param widget 
+     */
+    void removeWidget(const BaseWidget* widget) {
+        for (size_t i = 0; i < count; ++i) {
+            if (entries[i].widget == widget) {
+                for (size_t j = i; j < count - 1; ++j) {
+                    entries[j] = entries[j + 1];
+                    zOrder[j] = zOrder[j + 1];
+                }
+                --count;
+                entries[count] = Entry();
+                if ( captured == widget ) captured = nullptr;
+                if ( lastCaptured == widget ) lastCaptured = nullptr;
+                break;
+            }
+        }
+    }
+
+    /**
+     * @brief Remove all touch widgets and release capture
+     * 
+     */
+    void removeAllWidgets() {
+        for (size_t i = 0; i < count; ++i) {
+            entries[i] = Entry();
+        }
+        count = 0;
+        releaseCapture();
+    }
+
+    /**
+     * @brief Return the number of touch widgets
+     * 
+     * @return size_t 
+     */
+    size_t size() const { return count; }
+
+    protected:
+
+    /**
+     * @brief A touch widget and the functions that call its onTouchEvent() and isTouchHit()
+     */
+    struct Entry {
+        BaseWidget* widget = nullptr;
+        bool (*onTouch)(BaseWidget*, InputEventType, EventTouchScreen&) = nullptr;
+        bool (*isHit)(BaseWidget*, const Coords_s&) = nullptr;
+    };
+
+    /**
+     * @brief Return the index of the top-most hit for coords or InvalidIndex
+     * 
+     * @param coords 
+     * @return size_t 
+     */
+    size_t hitIndex(const Coords_s& coords) {
+        size_t hit = InvalidIndex;
+        size_t hitRank = 0;
+        for (size_t i = count; i > 0; --i) { //Top down in the dispatcher's order
+            if ( !entries[i-1].isHit(entries[i-1].widget, coords) ) continue;
+            if ( containerIndexOf == nullptr ) return i - 1;
+            size_t index = containerIndexOf(container, entries[i-1].widget);
+            size_t rank = index == InvalidIndex ? 0 : index + 1; //Not in the container is below
+            if ( hit == InvalidIndex || rank > hitRank ) {
+                hit = i - 1;
+                hitRank = rank;
+            }
+        }
+        return hit;
+    }
+
+    /**
+     * @brief Send the event to widget, if it is still in the dispatcher
+     * 
+     * @param widget 
+     * @param et 
+     * @param touchPanel 
+     * @return true 
+     * @return false 
+     */
+    bool send(BaseWidget* widget, InputEventType et, EventTouchScreen& touchPanel) {
+        if ( widget == nullptr ) return false;
+        for (size_t i = 0; i < count; ++i) {
+            if ( entries[i].widget == widget ) return entries[i].onTouch(widget, et, touchPanel);
+        }
+        return false;
+    }
+
+    Entry entries[maxWidgets] = {}; ///< The touch widgets
+    size_t count = 0; ///< Number of added widgets
+    uint8_t zOrder[maxWidgets] = {}; ///< The z-order of each widget
+    BaseWidget* captured = nullptr; ///< The widget that has captured the current touch
+    BaseWidget* lastCaptured = nullptr; ///< The widget that captured the last touch - receives the click events
+    const void* container = nullptr; ///< The attached container
+    size_t (*containerIndexOf)(const void*, const BaseWidget*) = nullptr; ///< Calls indexOf() of the attached container
+
+    private:
+
+    template<typename T>
+    static bool onTouchEventOf(BaseWidget* widget, InputEventType et, EventTouchScreen& touchPanel) {
+        return static_cast<T*>(widget)->onTouchEvent(et, touchPanel);
+    }
+
+    template<typename T>
+    static bool isTouchHitOf(BaseWidget* widget, const Coords_s& coords) {
+        return static_cast<T*>(widget)->isTouchHit(coords);
+    }
+
+    template<typename C>
+    static size_t indexIn(const void* container, const BaseWidget* widget) {
+        size_t index = static_cast<const C*>(container)->indexOf(widget);
+        return index == C::InvalidIndex ? InvalidIndex : index;
+    }
+
+};
+
+} //namespace
+#endif
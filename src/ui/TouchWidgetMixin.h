@@ -1,5 +1,5 @@
 /**
- *
+ * 
  * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
  * 
  * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
@@ -15,6 +15,10 @@ namespace input_events {
 /**
  * @brief A mixin class for BaseWidget that can act on touch within its DisplayArea
  * 
+ * @details When called from a `TouchDispatcher`, the widget hit on PRESSED receives all events until the touch is 
+ * released, so it is not necessary to re-check `contains()`. The dispatcher calls onTouchEvent() through the 
+ * derived widget and isTouchHit() of the derived widget directly.
+ * 
  */
 template <typename Derived>
 class TouchWidgetMixin {
@@ -34,6 +38,19 @@ class TouchWidgetMixin {
      */
     virtual bool onTouchEvent(InputEventType et, EventTouchScreen& touchPanel) = 0;
 
+    /**
+     * @brief Default hit test for `TouchDispatcher` - true if the derived widget is not hidden and contains coords.
+     * The derived widget can hide this with its own isTouchHit().
+     * 
+     * @param coords 
+     * @return true 
+     * @return false 
+     */
+    bool isTouchHit(const Coords_s& coords) {
+        Derived* self = static_cast<Derived*>(this);
+        return !self->isHidden() && self->contains(coords);
+    }
+
 
     protected:
     /**
@@ -56,7 +56,9 @@ class VirtualPinWidgetMixin {
     }
 
     /**
-     * @brief Default behaviour for a virtual pin if a touch event occurs. Maps InputEventType::PRESSED and InputEventType::RELEASED.
+     * @brief Default behaviour for a virtual pin if a touch event occurs. Maps InputEventType::PRESSED and InputEventType::RELEASED
+     * (or InputEventType::DRAGGED_RELEASED so the pin is not left pressed if the touch is dragged).
+     * Only the widget that pressed its pin releases it, so widgets sharing a touch event do not release each other's pins.
      * 
      * @param et 
      * @param touchPanel 
@@ -67,9 +69,11 @@ class VirtualPinWidgetMixin {
         Derived* self = static_cast<Derived*>(this);
         if ( !self->isButtonEnabled()  && self->contains(touchPanel.getTouchPoint()) ) return true; //Handled by not being handled
         if ( et == InputEventType::PRESSED && self->contains(touchPanel.getTouchPoint()) ) {
-            return pressVirtualPin();
+            pinPressed = pressVirtualPin();
+            return pinPressed;
         }
-        if ( et == InputEventType::RELEASED && self->contains(touchPanel.getStartTouchPoint()) ) {
+        if ( pinPressed && (et == InputEventType::RELEASED || et == InputEventType::DRAGGED_RELEASED) ) { //Only the widget that pressed the pin
+            pinPressed = false;
             return releaseVirtualPin();
         }
         return false;        
@@ -86,6 +90,7 @@ class VirtualPinWidgetMixin {
 
 
     VirtualPinAdapter* virtualPin = nullptr; ///< A reference to a VirtualPinAdapter for this mixin
+    bool pinPressed = false; ///< True if this widget pressed the pin and has not yet released it
 
 
 };
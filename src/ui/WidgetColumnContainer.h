@@ -0,0 +1,56 @@
+/**
+ *
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+#ifndef INPUT_EVENTS_WIDGET_COLUMN_CONTAINER_H
+#define INPUT_EVENTS_WIDGET_COLUMN_CONTAINER_H
+
+#include <Arduino.h>
+#include "WidgetSlotContainer.h"
+
+namespace input_events {
+
+/**
+ * @brief A WidgetColumnContainer is the vertical counterpart of WidgetRowContainer. It alters the Region (size/position) of contained widgets
+ * based on the column container Region and assigned position of the child widget.
+ * 
+ * @details The column is split into maxWidgets slots, top to bottom. By default the slots are equal height and the last is heightened to fill
+ * the column. Slots can be weighted or fixed height and separated by a gap - see `WidgetSlotContainer`.
+ * 
+ */
+template<size_t maxWidgets = INPUT_EVENTS_WIDGET_CONTAINER_DEFAULT_MAX>
+class WidgetColumnContainer  : public WidgetSlotContainer<maxWidgets, true> {
+
+    public:
+
+    using Base = WidgetContainer<maxWidgets>; ///< Make life easier
+
+    /**
+     * @brief Construct a WidgetColumnContainer using a Region
+     * 
+     * @param region 
+     */
+    explicit WidgetColumnContainer(Region region ) : 
+        WidgetSlotContainer<maxWidgets, true>(region)
+        {}
+
+    /**
+     * @brief Construct a WidgetColumnContainer using x, y, width and height
+     * 
+     * @param x 
+     * @param y 
+     * @param w 
+     * @param h 
+     */
+    WidgetColumnContainer(uint16_t x, uint16_t y, uint16_t w, uint16_t h ) : 
+        WidgetSlotContainer<maxWidgets, true>(Region(x, y, w, h))
+        {}
+
+};
+
+} //namespace
+#endif
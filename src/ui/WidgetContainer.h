@@ -15,15 +15,36 @@
  */
 #define WIDGET_CONTAINER_DEFAULT_MAX 5
 #endif
+#ifndef INPUT_EVENTS_WIDGET_CONTAINER_DEFAULT_MAX
+/**
+ * @brief The default template argument for containers (set `WIDGET_CONTAINER_DEFAULT_MAX` to change)
+ */
+#define INPUT_EVENTS_WIDGET_CONTAINER_DEFAULT_MAX WIDGET_CONTAINER_DEFAULT_MAX
+#endif
 
 #include <Arduino.h>
 #include "BaseWidget.h"
+#include "ClipStack.h"
+#include "YieldPoint.h"
 
 namespace input_events {
 
 /**
  * @brief A widget container that will draw() all added widgets if not WidgetDisplayState::HIDDEN and always call all widgets begin() and end()
  * 
+ * @details Widgets are held in z-order (lowest first) and drawn in that order. Widgets with the same z-order are held in the 
+ * order they were added. If a widget is marked opaque with `setOpaque()`, any widget below it that it fully covers
+ * is occluded and its draw() is skipped (and its redraw cleared). When the covering widget is hidden, the widgets 
+ * below it are set to redraw. When a widget that required a redraw is drawn, the widgets above it that it 
+ * intersects are set to redraw, as it may have painted over them.
+ * 
+ * Each widget's Region is pushed onto the `clipStack()` around its draw(), and widgets entirely outside the current 
+ * clip (eg when the container is drawn within a partial redraw Region) are not drawn. A nested container whose 
+ * widgets lie outside its Region (or that has no size) is not clipped; its widgets are clipped to their own Regions.
+ * 
+ * `yieldPoint()` is called after each widget is drawn, so urgent work (eg touch sampling by a `TaskScheduler`) 
+ * is not delayed until the whole container has been drawn.
+ * 
  */
 template<size_t maxWidgets = INPUT_EVENTS_WIDGET_CONTAINER_DEFAULT_MAX>
 class WidgetContainer  : public BaseWidget {
@@ -93,17 +114,82 @@ class WidgetContainer  : public BaseWidget {
         }
     }
 
+    /**
+     * @brief Call onThemeChanged() of all contained widgets (even if hidden)
+     * 
+     * @param changedStyles 
+     */
+    void onThemeChanged(uint32_t changedStyles) override {
+        for (size_t i = 0; i < count; ++i) {
+            if ( widgets[i] ) {
+                widgets[i]->onThemeChanged(changedStyles);
+            }
+        }
+    }
+
     /**
      * @brief If not hidden, call draw() of all contained widgets
      * 
      */
     void draw() override { //Loop through widgets if not HIDDEN
         if ( this->isHidden() ) return;
+        for (size_t i = 0; i < count; ++i) { //Redraw what was under an opaque widget that is now hidden
+            if ( widgets[i] && (flags[i] & FLAG_OPAQUE) ) {
+                bool shown = !widgets[i]->isHidden();
+                if ( !shown && (flags[i] & FLAG_SHOWN) ) redrawBelow(i);
+                flags[i] = shown ? (flags[i] | FLAG_SHOWN) : (flags[i] & ~FLAG_SHOWN);
+            }
+        }
         for (size_t i = 0; i < count; ++i) {
             if ( widgets[i] ) {
-                widgets[i]->draw();
+                if ( isOccluded(i) ) {
+                    flags[i] |= FLAG_OCCLUDED;
+                    widgets[i]->redrawRequired(false); //Redrawn when uncovered
+                    continue;
+                }
+                if ( flags[i] & FLAG_OCCLUDED ) {
+                    flags[i] &= ~FLAG_OCCLUDED;
+                    widgets[i]->redrawRequired();
+                }
+                if ( widgets[i]->isClippedToRegion() ) {
+                    ClipScope clip(*widgets[i]);
+                    if ( clip.isVisible() ) drawWidget(i); //Outside the clip is drawn by a later (partial) redraw
+                } else {
+                    drawWidget(i); //Its children push their own clip
+                }
             }
         }
+        BaseWidget::redrawRequired(false); //Only the container's own flag, widgets clear theirs when drawn
+    }
+
+    /**
+     * @brief If not hidden, returns true if the container or any contained widget requires a redraw
+     * 
+     * @return true 
+     * @return false 
+     */
+    bool isRedrawPending() override {
+        if ( this->isHidden() ) return false;
+        if ( isRedrawRequired() ) return true;
+        for (size_t i = 0; i < count; ++i) {
+            if ( widgets[i] && widgets[i]->isRedrawPending() ) return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Returns false if the container has no size or any contained widget lies outside its Region, so the 
+     * widgets are clipped to their own Regions rather than the container's.
+     * 
+     * @return true 
+     * @return false 
+     */
+    bool isClippedToRegion() override {
+        if ( this->w() == 0 || this->h() == 0 ) return false;
+        for (size_t i = 0; i < count; ++i) {
+            if ( widgets[i] && !this->contains(*widgets[i]) ) return false;
+        }
+        return true;
     }
 
     /**
@@ -144,14 +230,28 @@ class WidgetContainer  : public BaseWidget {
     /**
      * @brief Add a widget to the container
      * 
+     * @details The widget is placed above all widgets with the same or lower z-order. If all widgets have the
+     * default z-order of 0, this is the order they are added. 
+     * 
      * @param widget 
-     * @return size_t 
+     * @param z The z-order. Higher values are drawn later (on top) and hit first by `widgetAt()`.
+     * @return size_t The index of the widget
      */
-    size_t addWidget(BaseWidget* widget) {
+    size_t addWidget(BaseWidget* widget, uint8_t z = 0) {
         if (count >= maxWidgets)
             return InvalidIndex;
-        widgets[count] = widget;
-        return count++;  // Return the index before incrementing
+        size_t index = count;
+        while ( index > 0 && zOrder[index - 1] > z ) { //Shift higher widgets up
+            widgets[index] = widgets[index - 1];
+            zOrder[index] = zOrder[index - 1];
+            flags[index] = flags[index - 1];
+            --index;
+        }
+        widgets[index] = widget;
+        zOrder[index] = z;
+        flags[index] = 0;
+        count++;
+        return index;
     }
 
     /**
@@ -164,6 +264,8 @@ class WidgetContainer  : public BaseWidget {
         // Shift widgets down to fill the gap
         for (size_t i = index; i < count - 1; ++i) {
             widgets[i] = widgets[i + 1];
+            zOrder[i] = zOrder[i + 1];
+            flags[i] = flags[i + 1];
         }
         --count;
         widgets[count] = nullptr;
@@ -207,6 +309,7 @@ class WidgetContainer  : public BaseWidget {
             return false;  // Invalid index
         }
         widgets[index] = newWidget;
+        flags[index] = 0; //Keeps z-order but not opacity
         return true;
     }
 
@@ -221,13 +324,97 @@ class WidgetContainer  : public BaseWidget {
     bool replaceWidget(BaseWidget* oldWidget, BaseWidget* newWidget) {
         for (size_t i = 0; i < count; ++i) {
             if (widgets[i] == oldWidget) {
-                widgets[i] = newWidget;
-                return true;
+                return replaceWidget(i, newWidget);
             }
         }
         return false;
     }    
 
+    /**
+     * @brief Change the z-order of a contained widget. The widget is placed above all widgets with the same or lower z-order.
+     * 
+     * @param widget 
+     * @param z 
+     * @return size_t The new index of the widget or InvalidIndex if not contained.
+     */
+    size_t setZOrder(BaseWidget* widget, uint8_t z) {
+        size_t index = indexOf(widget);
+        if ( index == InvalidIndex ) return InvalidIndex;
+        uint8_t f = flags[index];
+        removeWidget(index);
+        index = addWidget(widget, z);
+        flags[index] = f;
+        return index;
+    }
+
+    /**
+     * @brief Get the z-order of a contained widget (0 if not contained)
+     * 
+     * @param widget 
+     * @return uint8_t 
+     */
+    uint8_t getZOrder(BaseWidget* widget) {
+        size_t index = indexOf(widget);
+        return index == InvalidIndex ? 0 : zOrder[index];
+    }
+
+    /**
+     * @brief Mark a contained widget as opaque, ie its draw() paints every pixel of its Region, so any widget below
+     * it that is fully inside its Region does not need to be drawn.
+     * 
+     * @param widget 
+     * @param opaque 
+     */
+    void setOpaque(BaseWidget* widget, bool opaque = true) {
+        size_t index = indexOf(widget);
+        if ( index == InvalidIndex ) return;
+        flags[index] = opaque ? (flags[index] | FLAG_OPAQUE) : (flags[index] & ~(FLAG_OPAQUE | FLAG_SHOWN));
+    }
+
+    /**
+     * @brief Returns true if the widget at index is fully covered by a visible opaque widget above it.
+     * 
+     * @param index 
+     * @return true 
+     * @return false 
+     */
+    bool isOccluded(size_t index) {
+        if ( index >= count || !widgets[index] ) return false;
+        for (size_t j = index + 1; j < count; ++j) {
+            if ( widgets[j] && (flags[j] & FLAG_OPAQUE) && !widgets[j]->isHidden() 
+                    && widgets[j]->contains(*widgets[index]) ) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Return the top-most (highest z-order) widget that is not hidden and contains coords, or nullptr.
+     * 
+     * @param coords 
+     * @return BaseWidget* 
+     */
+    BaseWidget* widgetAt(const Coords_s& coords) {
+        for (size_t i = count; i > 0; --i) {
+            if ( widgets[i-1] && !widgets[i-1]->isHidden() && widgets[i-1]->contains(coords) ) return widgets[i-1];
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Return the index of a contained widget or InvalidIndex.
+     * 
+     * @param widget 
+     * @return size_t 
+     */
+    size_t indexOf(const BaseWidget* widget) const {
+        for (size_t i = 0; i < count; ++i) {
+            if ( widgets[i] == widget ) return i;
+        }
+        return InvalidIndex;
+    }
+
     /**
      * @brief Return the number of contained widgets
      * 
@@ -240,6 +427,33 @@ class WidgetContainer  : public BaseWidget {
 
     BaseWidget* widgets[maxWidgets]; ///< the contained widgets
     size_t count = 0; ///< Number of added widgets
+    uint8_t zOrder[maxWidgets] = {}; ///< The z-order of each contained widget
+    uint8_t flags[maxWidgets] = {}; ///< Opacity and occlusion of each contained widget
+
+    static const uint8_t FLAG_OPAQUE = 0x01; ///< The widget paints all of its Region
+    static const uint8_t FLAG_OCCLUDED = 0x02; ///< The widget was occluded when last drawn
+    static const uint8_t FLAG_SHOWN = 0x04; ///< The opaque widget was not hidden when last drawn
+
+    private:
+
+    void drawWidget(size_t index) {
+        bool drawing = widgets[index]->isRedrawPending();
+        widgets[index]->draw();
+        if ( drawing ) redrawAbove(index); //May have painted over them
+        yieldPoint();
+    }
+
+    void redrawAbove(size_t index) {
+        for (size_t i = index + 1; i < count; ++i) {
+            if ( widgets[i] && !widgets[i]->isHidden() && widgets[i]->intersects(*widgets[index]) ) widgets[i]->redrawRequired();
+        }
+    }
+
+    void redrawBelow(size_t index) {
+        for (size_t i = 0; i < index; ++i) {
+            if ( widgets[i] && widgets[i]->intersects(*widgets[index]) ) widgets[i]->redrawRequired();
+        }
+    }
 
 };
 
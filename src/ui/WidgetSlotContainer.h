@@ -0,0 +1,200 @@
+/**
+ * 
+ * GPLv2 Licence https://www.gnu.org/licenses/old-licenses/gpl-2.0.txt
+ * 
+ * Copyright (c) 2025 Philip Fletcher <philip.fletcher@stutchbury.com>
+ * 
+ */
+
+#ifndef INPUT_EVENTS_WIDGET_SLOT_CONTAINER_H
+#define INPUT_EVENTS_WIDGET_SLOT_CONTAINER_H
+
+#include <Arduino.h>
+#include "WidgetContainer.h"
+#include "Layout.h"
+
+namespace input_events {
+
+/**
+ * @brief The base of WidgetRowContainer and WidgetColumnContainer. Splits the container Region into maxWidgets slots 
+ * (left to right or top to bottom) and sets the Region of each contained widget to the Region of its slot.
+ * 
+ * @details By default all slots have an equal weight, no gap and the last slot is widened to fill any remainder. 
+ * Slots can be weighted or a fixed number of pixels (see `layout::Slot`) and separated by a gap.
+ * 
+ * Slot positions are calculated once, in a single pass, and only recalculated when the slots, gap or container
+ * Region change. If the container Region is changed after widgets have been added, call `layout()` (or `start()`).
+ * 
+ * @tparam maxWidgets The maximum number of widgets (and slots)
+ * @tparam Vertical false for a row, true for a column
+ */
+template<size_t maxWidgets, bool Vertical>
+class WidgetSlotContainer  : public WidgetContainer<maxWidgets> {
+
+    public:
+
+    using Base = WidgetContainer<maxWidgets>; ///< Make life easier
+
+    /**
+     * @brief Add a widget to the container in slot position 
+     * 
+     * @details The position is only used to calculate the x, y, w, h for the contained widget
+     * 
+     * @param widget 
+     * @param position 
+     * @return size_t 
+     */
+    size_t add(BaseWidget* widget, uint8_t position ) {
+        size_t newIndex = Base::addWidget(widget);
+        if ( newIndex == Base::InvalidIndex ) return Base::InvalidIndex;
+        if ( position < maxWidgets ) slotted[position] = widget;
+        setWidgetRegion(widget, position);
+        return newIndex;
+    }
+
+    /**
+     * @brief Set the slot at position to be weighted or fixed size, eg `setSlot(0, layout::fixed(40))` or `setSlot(1, 2)`
+     * 
+     * @param position 
+     * @param slot 
+     */
+    void setSlot(uint8_t position, layout::Slot slot) {
+        if ( position >= maxWidgets ) return;
+        slots[position] = slot;
+        layoutValid = false;
+        layout();
+    }
+
+    /**
+     * @brief Set the slots for all positions
+     * 
+     * @param newSlots 
+     */
+    void setSlots(const layout::Slot (&newSlots)[maxWidgets]) {
+        for (size_t i = 0; i < maxWidgets; ++i) {
+            slots[i] = newSlots[i];
+        }
+        layoutValid = false;
+        layout();
+    }
+
+    /**
+     * @brief Set the gap in pixels between slots
+     * 
+     * @param px 
+     */
+    void setGap(uint16_t px) {
+        if ( px == gap ) return;
+        gap = px;
+        layoutValid = false;
+        layout();
+    }
+
+    /**
+     * @brief Return the Region of the slot at position (or an empty Region if position is out of bounds)
+     * 
+     * @param position 
+     * @return Region 
+     */
+    Region getSlotRegion(uint8_t position) {
+        if ( position >= maxWidgets ) return Region();
+        updateSlots();
+        if ( Vertical ) return Region(this->x(), slotPos[position], this->w(), slotSize[position]);
+        return Region(slotPos[position], this->y(), slotSize[position], this->h());
+    }
+
+    /**
+     * @brief Recalculate the slots if the slots, gap or container Region has changed and set the Region of all 
+     * widgets added with `add()`.
+     * 
+     */
+    void layout() {
+        if ( !updateSlots() ) return;
+        for (uint8_t p = 0; p < maxWidgets; ++p) {
+            if ( slotted[p] && isContained(slotted[p]) ) setWidgetRegion(slotted[p], p);
+        }
+    }
+
+    /**
+     * @brief Apply any layout change then call start() of all contained widgets
+     * 
+     */
+    void start() override {
+        layout();
+        Base::start();
+    }
+
+    /**
+     * @brief Calculate and set the Region for widget at index for position (not normally called directly)
+     * 
+     * @param index 
+     * @param position 
+     */
+    void setWidgetRegion(size_t index, uint8_t position ) {
+        if ( index >= this->count ) return;
+        if ( position >= maxWidgets ) return;
+        if ( !this->widgets[index] ) return;
+        setWidgetRegion(this->widgets[index], position);
+    }
+
+    /**
+     * @brief Calculate and set the Region for the passed widget for position (not normally called directly)
+     * 
+     * @param widget 
+     * @param position 
+     */
+    void setWidgetRegion(BaseWidget* widget, uint8_t position ) {
+        if ( !widget ) return;
+        if ( position >= maxWidgets ) return;
+        widget->setRegion(getSlotRegion(position));
+    }
+
+    protected:
+
+    /**
+     * @brief Construct with a Region (only via WidgetRowContainer or WidgetColumnContainer)
+     * 
+     * @param region 
+     */
+    explicit WidgetSlotContainer(Region region ) : 
+        Base(region)
+        {}
+
+    /**
+     * @brief Recalculate slot positions and sizes if required
+     * 
+     * @return true If recalculated
+     * @return false If unchanged
+     */
+    bool updateSlots() {
+        if ( layoutValid && layoutRegion.x() == this->x() && layoutRegion.y() == this->y() 
+                && layoutRegion.w() == this->w() && layoutRegion.h() == this->h() ) return false; //Any change moves the widgets
+        uint16_t start = Vertical ? this->y() : this->x();
+        uint16_t length = Vertical ? this->h() : this->w();
+        layout::split(start, length, slots, maxWidgets, gap, slotPos, slotSize);
+        layoutRegion.setRegion(*this);
+        layoutValid = true;
+        return true;
+    }
+
+    private:
+
+    bool isContained(const BaseWidget* widget) {
+        for (size_t i = 0; i < this->count; ++i) {
+            if ( this->widgets[i] == widget ) return true;
+        }
+        return false;
+    }
+
+    layout::Slot slots[maxWidgets];
+    BaseWidget* slotted[maxWidgets] = {};
+    uint16_t slotPos[maxWidgets] = {};
+    uint16_t slotSize[maxWidgets] = {};
+    uint16_t gap = 0;
+    Region layoutRegion; //The container Region when the slots were calculated
+    bool layoutValid = false;
+
+};
+
+} //namespace
+#endif